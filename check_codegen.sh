@@ -0,0 +1,54 @@
+#!/bin/sh
+# Compiles the probes of maybe_uninit_checks.cpp at -O2 with each compiler of $CXX, GCC and Clang by default, and fails
+# if their assembly holds a memset, a call to non_trivial_probe's constructor or destructor, or if
+# probe_destroy_trivial compiles to anything but a return. Compilers which aren't installed are skipped.
+# Usage: [CXX="g++-14 clang++-18"] [CXXFLAGS=...] ./check_codegen.sh
+
+set -eu
+
+dir=$(dirname "$0")
+compilers=${CXX:-"g++ clang++"}
+flags=${CXXFLAGS:-"-std=c++26"}
+status=0
+checked=0
+
+for cxx in $compilers; do
+    if ! command -v "$cxx" > /dev/null 2>&1; then
+        echo "skipped $cxx: not installed"
+        continue
+    fi
+    # shellcheck disable=SC2086
+    asm=$("$cxx" $flags -O2 -S -o - "$dir/maybe_uninit_checks.cpp")
+    checked=$((checked + 1))
+
+    if printf '%s\n' "$asm" | grep -E 'memset|rep stos'; then
+        echo "FAIL $cxx: memset emitted"
+        status=1
+    fi
+    if printf '%s\n' "$asm" | grep -E 'non_trivial_probe[CD][0-9]E'; then
+        echo "FAIL $cxx: non_trivial_probe constructor or destructor called"
+        status=1
+    fi
+    # Instructions of probe_destroy_trivial, without labels, directives and comments.
+    body=$(printf '%s\n' "$asm" | awk '
+        /^_Z.*probe_destroy_trivial.*:/ { inside = 1; next }
+        inside && /\.cfi_endproc/ { exit }
+        inside {
+            sub(/#.*/, "")
+            if ($0 ~ /^[[:space:]]*$/ || $1 ~ /^\./ || $1 ~ /:$/ || $1 == "endbr64") next
+            print $1
+        }
+    ')
+    if [ "$body" != "ret" ] && [ "$body" != "retq" ]; then
+        echo "FAIL $cxx: probe_destroy_trivial isn't empty:"
+        printf '%s\n' "$body"
+        status=1
+    fi
+    echo "checked $cxx"
+done
+
+if [ "$checked" -eq 0 ]; then
+    echo "FAIL: no compiler found"
+    exit 1
+fi
+exit "$status"
@@ -0,0 +1,279 @@
+/// @file
+/// @brief Defines the template type `compact_optional`, an optional value which encodes its empty state as a sentinel
+/// bit pattern of its `maybe_uninit` storage, so that it's no larger than the value.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <array>
+#include <bit>
+#include <climits>
+#include <concepts>
+#include <cstddef>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+/// @brief Traits telling which value of type `T` a `compact_optional<T>` uses as its empty state.
+/// @details Defined for pointers, whose sentinel is `nullptr`, floating-point types, whose sentinel is a quiet NaN, and
+/// unsigned integers other than `bool` and character types, whose sentinel is their maximum value, i.e. `-1`
+/// converted. Other types can opt in by specializing this trait in the library's namespace, or by passing their own
+/// traits to `compact_optional`:
+/// @code {.cpp}
+///     template <>
+///     struct mem::compact_optional_traits<Handle> {
+///         static constexpr auto sentinel() noexcept -> Handle { return Handle::invalid; }
+///     };
+/// @endcode
+template <typename T>
+struct compact_optional_traits;
+
+/// @brief Pointers are empty when null.
+template <typename T>
+struct compact_optional_traits<T*> {
+    static constexpr auto sentinel() noexcept -> T* {
+        return nullptr;
+    }
+};
+
+/// @brief Floating-point values are empty when they're the quiet NaN of `std::numeric_limits`.
+template <std::floating_point T>
+struct compact_optional_traits<T> {
+    static constexpr auto sentinel() noexcept -> T {
+        return std::numeric_limits<T>::quiet_NaN();
+    }
+};
+
+namespace detail {
+
+/// @brief Matches unsigned integer types used as numbers, i.e. neither `bool`, whose maximum is one of only two
+/// values, nor character types, whose maximum may be a valid code unit.
+template <typename T>
+concept unsigned_number = std::unsigned_integral<T> and not std::same_as<T, bool> and not std::same_as<T, char>
+                      and not std::same_as<T, wchar_t> and not std::same_as<T, char8_t>
+                      and not std::same_as<T, char16_t> and not std::same_as<T, char32_t>;
+
+} // namespace detail
+
+/// @brief Unsigned integers are empty when they're their maximum value. `bool` and character types have no default
+/// sentinel.
+template <detail::unsigned_number T>
+struct compact_optional_traits<T> {
+    static constexpr auto sentinel() noexcept -> T {
+        return std::numeric_limits<T>::max();
+    }
+};
+
+/// @brief Traits whose sentinel is `Value`, e.g. `sentinel_value<-1>` for signed indices.
+template <auto Value>
+struct sentinel_value {
+    static constexpr auto sentinel() noexcept {
+        return Value;
+    }
+};
+
+namespace detail {
+
+/// @brief Matches traits whose sentinel is a constant expression of type `T`.
+template <typename Traits, typename T>
+concept sentinel_traits_for = requires {
+    { Traits::sentinel() } -> std::convertible_to<T>;
+    std::integral_constant<bool, (static_cast<void>(Traits::sentinel()), true)>{};
+};
+
+/// @brief Matches IEEE 754 binary floating-point types whose sign, exponent and significand bits fill their object
+/// representation, such as `float` and `double`, but not the x87 80-bit `long double`, which is padded to 12 or 16
+/// bytes. The significand's implicit bit, counted in `digits`, stands in for the sign bit.
+template <typename T>
+concept padding_free_floating_point
+    = std::floating_point<T> and std::numeric_limits<T>::is_iec559
+  and std::numeric_limits<T>::digits + std::bit_width(static_cast<unsigned>(std::numeric_limits<T>::max_exponent))
+          == static_cast<int>(sizeof(T) * CHAR_BIT);
+
+/// @brief Matches `T`s whose values are fully described by their object representation, so that an empty state can be
+/// told apart from values by comparing bytes. Floating-point types without padding are included, although several
+/// bit patterns may compare equal or unordered, as only the exact bit pattern of the sentinel is reserved.
+template <typename T>
+concept bytewise_comparable = std::is_trivially_copyable_v<T>
+                          and (std::has_unique_object_representations_v<T> or padding_free_floating_point<T>);
+
+} // namespace detail
+
+/// @brief Optional value, like `std::optional<T>`, which stores nothing but the value, and encodes its empty state as
+/// the bit pattern of a sentinel value chosen by `Traits`.
+/// @details `std::optional<T>` stores a `bool` next to the value, which doubles the size of an optional 8-byte index
+/// once padded. `compact_optional<T>` instead stores the sentinel in its `maybe_uninit<T>` storage while empty, and
+/// tells whether it holds a value by comparing the bytes of its storage with those of the sentinel, so
+/// `sizeof(compact_optional<T>) == sizeof(T)`:
+/// @code {.cpp}
+///     auto parents = std::vector<compact_optional<std::uint32_t>>(n);  // 4 bytes per node, empty by default.
+///     parents[child] = parent;
+///     if (parents[root].has_value()) { /* ... */ }
+///
+///     auto weights = std::vector<compact_optional<double>>(n);         // empty weights are NaN.
+/// @endcode
+/// Comparing bytes rather than values makes NaN usable as a sentinel, and distinguishes `-0.0` from `0.0`.
+/// @tparam T Type of the value. Must be trivially copyable, and have no padding bits.
+/// @tparam Traits Type whose `static constexpr sentinel()` member function returns the sentinel.
+/// @attention The sentinel is reserved: storing a value whose bit pattern is that of the sentinel makes the optional
+/// empty. Checked if `MAYBE_UNINIT_CHECKED` is enabled.
+/// @see `compact_optional_traits`
+template <detail::sized T, typename Traits = compact_optional_traits<T>>
+    requires(detail::bytewise_comparable<T> and detail::sentinel_traits_for<Traits, T>)
+class compact_optional {
+  public:
+    using value_type = T;
+    using traits_type = Traits;
+
+    /// @brief Default constructor. Constructs an empty optional.
+    constexpr compact_optional() noexcept
+        : storage(paren_init_t{}, sentinel) {}
+
+    /// @brief Constructs an empty optional.
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    constexpr compact_optional(std::nullopt_t) noexcept
+        : compact_optional() {}
+
+    /// @brief Constructs an optional holding @p value.
+    /// @pre @p value isn't the sentinel. Checked if `MAYBE_UNINIT_CHECKED` is enabled.
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    constexpr compact_optional(T const& value) noexcept
+        : storage(paren_init_t{}, value) {
+        this->check_not_sentinel();
+    }
+
+    /// @brief Constructs an optional holding a value constructed as if by `T(std::forward<Args>(args)...)`.
+    /// @pre The value isn't the sentinel. Checked if `MAYBE_UNINIT_CHECKED` is enabled.
+    template <typename... Args>
+    explicit constexpr compact_optional(std::in_place_t, Args&&... args) noexcept(
+        detail::nothrow_paren_constructible_from<T, Args...>
+    )
+        requires detail::paren_constructible_from<T, Args...>
+        : storage(paren_init_t{}, std::forward<Args>(args)...) {
+        this->check_not_sentinel();
+    }
+
+    /// @brief Empties the optional.
+    constexpr auto operator=(std::nullopt_t) noexcept -> compact_optional& {
+        this->reset();
+        return *this;
+    }
+
+    /// @brief Returns whether the optional holds a value, i.e. whether the bytes of its storage differ from those of
+    /// the sentinel.
+    [[nodiscard]]
+    constexpr auto has_value() const noexcept -> bool {
+        if consteval {
+            // Pointers can't be bit-cast during constant evaluation, but have a single null representation.
+            if constexpr (std::is_pointer_v<T>) {
+                return this->storage.ref() != sentinel;
+            } else {
+                return std::bit_cast<bytes_type>(this->storage.ref()) != std::bit_cast<bytes_type>(sentinel);
+            }
+        }
+        return std::memcmp(this->storage.bytes().data(), std::addressof(sentinel), sizeof(T)) != 0;
+    }
+
+    /// @brief Returns whether the optional holds a value.
+    [[nodiscard]]
+    constexpr explicit operator bool() const noexcept {
+        return this->has_value();
+    }
+
+    /// @brief Returns a reference to the value, preserving the value category of @p self.
+    /// @pre The optional holds a value.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto operator*(this Self&& self) noexcept -> auto&& {
+        return std::forward<Self>(self).storage.ref();
+    }
+
+    /// @brief Returns a pointer to the value, preserving the constness of @p self.
+    /// @pre The optional holds a value.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto operator->(this Self&& self) noexcept -> auto* {
+        return std::forward<Self>(self).storage.ptr();
+    }
+
+    /// @brief Returns a reference to the value, preserving the value category of @p self.
+    /// @note Throws `std::bad_optional_access` if the optional is empty.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto value(this Self&& self) -> auto&& {
+        if (not self.has_value()) {
+            throw std::bad_optional_access();
+        }
+        return std::forward<Self>(self).storage.ref();
+    }
+
+    /// @brief Returns the value, or @p default_value converted to `T` if the optional is empty.
+    template <typename U>
+    [[nodiscard]]
+    constexpr auto value_or(U&& default_value) const noexcept(std::is_nothrow_convertible_v<U, T>) -> T
+        requires std::convertible_to<U, T>
+    {
+        return this->has_value() ? this->storage.ref() : static_cast<T>(std::forward<U>(default_value));
+    }
+
+    /// @brief Replaces the value, if any, with a value constructed as if by `T(std::forward<Args>(args)...)`.
+    /// @returns A reference to the new value.
+    /// @pre The value isn't the sentinel. Checked if `MAYBE_UNINIT_CHECKED` is enabled.
+    template <typename... Args>
+    constexpr auto emplace(Args&&... args) noexcept(detail::nothrow_paren_constructible_from<T, Args...>) -> T&
+        requires detail::paren_constructible_from<T, Args...>
+    {
+        auto& value = this->storage.paren_init(std::forward<Args>(args)...);
+        this->check_not_sentinel();
+        return value;
+    }
+
+    /// @brief Empties the optional, by storing the sentinel.
+    constexpr auto reset() noexcept {
+        this->storage.paren_init(sentinel);
+    }
+
+    /// @brief Returns whether @p lhs and @p rhs are both empty, or both hold equal values.
+    [[nodiscard]]
+    friend constexpr auto operator==(compact_optional const& lhs, compact_optional const& rhs) noexcept(
+        noexcept(*lhs == *rhs)
+    ) -> bool
+        requires std::equality_comparable<T>
+    {
+        auto const engaged = lhs.has_value();
+        return engaged == rhs.has_value() and (not engaged or *lhs == *rhs);
+    }
+
+    /// @brief Returns whether @p optional is empty.
+    [[nodiscard]]
+    friend constexpr auto operator==(compact_optional const& optional, std::nullopt_t) noexcept -> bool {
+        return not optional.has_value();
+    }
+
+  private:
+    using bytes_type = std::array<std::byte, sizeof(T)>;
+
+    /// @brief The value stored while empty.
+    static constexpr auto sentinel = static_cast<T>(Traits::sentinel());
+
+    /// @brief Fails via `MAYBE_UNINIT_CHECK_FAILED` if the stored value is the sentinel, if `MAYBE_UNINIT_CHECKED` is
+    /// enabled.
+    constexpr auto check_not_sentinel() const noexcept {
+#if MAYBE_UNINIT_CHECKED
+        if (not this->has_value()) {
+            MAYBE_UNINIT_CHECK_FAILED("compact_optional assigned its sentinel value");
+        }
+#endif
+    }
+
+    /// @brief The value, or the sentinel while empty.
+    maybe_uninit<T> storage;
+};
+
+} // namespace MAYBE_UNINIT_NAMESPACE
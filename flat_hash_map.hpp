@@ -0,0 +1,820 @@
+/// @file
+/// @brief Defines the template type `flat_hash_map`, an open-addressing hash map after the design of Abseil's Swiss
+/// tables, whose slot array is made of `maybe_uninit` slots.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#if defined(__SSE2__) or defined(_M_X64) or (defined(_M_IX86_FP) and _M_IX86_FP >= 2)
+#   define MAYBE_UNINIT_SSE2 1
+#   include <emmintrin.h>
+#endif
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+namespace detail {
+
+/// @brief Control byte of a slot of a `flat_hash_map`. Full slots hold the 7 low bits of the hash of their key, and
+/// other states are negative.
+using ctrl_t = std::int8_t;
+
+/// @brief Control byte of a slot which never held an element since the last rehash. Ends probe sequences.
+inline constexpr auto ctrl_empty = ctrl_t{-128};
+
+/// @brief Control byte of a slot whose element was erased. Doesn't end probe sequences.
+inline constexpr auto ctrl_deleted = ctrl_t{-2};
+
+/// @brief Control byte following the last slot, which stops iteration.
+inline constexpr auto ctrl_sentinel = ctrl_t{-1};
+
+/// @brief Bit mask of the slots of a group matching a predicate, where slot `i` is represented by the highest bit of
+/// the `i`-th chunk of `1 << Shift` bits.
+template <std::unsigned_integral U, int Shift>
+struct ctrl_mask {
+    /// @brief Returns whether any slot matches.
+    [[nodiscard]]
+    constexpr explicit operator bool() const noexcept {
+        return this->bits != 0;
+    }
+
+    /// @brief Returns the index of the first matching slot.
+    /// @pre A slot matches.
+    [[nodiscard]]
+    constexpr auto lowest() const noexcept -> std::size_t {
+        return static_cast<std::size_t>(std::countr_zero(this->bits)) >> Shift;
+    }
+
+    /// @brief Removes the first matching slot.
+    constexpr auto clear_lowest() noexcept {
+        this->bits &= this->bits - 1;
+    }
+
+    U bits;
+};
+
+#ifdef MAYBE_UNINIT_SSE2
+
+/// @brief Group of 16 control bytes, matched with SSE2 instructions.
+class ctrl_group {
+  public:
+    static constexpr std::size_t width = 16;
+
+    /// @brief Loads the control bytes starting at @p ctrl.
+    explicit ctrl_group(ctrl_t const* const ctrl) noexcept
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        : ctrl(_mm_loadu_si128(reinterpret_cast<__m128i const*>(ctrl))) {}
+
+    /// @brief Returns the full slots whose control byte is @p h2.
+    [[nodiscard]]
+    auto match(ctrl_t const h2) const noexcept -> ctrl_mask<std::uint32_t, 0> {
+        return {static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_set1_epi8(h2), this->ctrl)))};
+    }
+
+    /// @brief Returns the empty slots.
+    [[nodiscard]]
+    auto match_empty() const noexcept -> ctrl_mask<std::uint32_t, 0> {
+        return this->match(ctrl_empty);
+    }
+
+    /// @brief Returns the empty or deleted slots, i.e. those whose control byte is less than `ctrl_sentinel`.
+    [[nodiscard]]
+    auto match_empty_or_deleted() const noexcept -> ctrl_mask<std::uint32_t, 0> {
+        auto const special = _mm_cmpgt_epi8(_mm_set1_epi8(ctrl_sentinel), this->ctrl);
+        return {static_cast<std::uint32_t>(_mm_movemask_epi8(special))};
+    }
+
+  private:
+    __m128i ctrl;
+};
+
+#else
+
+/// @brief Group of 8 control bytes, matched with bitwise operations on a 64-bit word.
+class ctrl_group {
+  public:
+    static constexpr std::size_t width = 8;
+
+    /// @brief Loads the control bytes starting at @p ctrl.
+    explicit ctrl_group(ctrl_t const* const ctrl) noexcept {
+        std::memcpy(&this->ctrl, ctrl, sizeof(this->ctrl));
+        if constexpr (std::endian::native == std::endian::big) {
+            this->ctrl = std::byteswap(this->ctrl);
+        }
+    }
+
+    /// @brief Returns the full slots whose control byte is @p h2. May also return full slots whose control byte is
+    /// `h2 ^ 1` and which follow a match, which key comparisons then reject.
+    [[nodiscard]]
+    auto match(ctrl_t const h2) const noexcept -> ctrl_mask<std::uint64_t, 3> {
+        auto const x = this->ctrl ^ (lsbs * static_cast<std::uint8_t>(h2));
+        return {(x - lsbs) & ~x & msbs};
+    }
+
+    /// @brief Returns the empty slots, i.e. those whose control byte has its high bit set and its second lowest bit
+    /// clear.
+    [[nodiscard]]
+    auto match_empty() const noexcept -> ctrl_mask<std::uint64_t, 3> {
+        return {this->ctrl & ~(this->ctrl << 6) & msbs};
+    }
+
+    /// @brief Returns the empty or deleted slots, i.e. those whose control byte has its high bit set and its lowest
+    /// bit clear.
+    [[nodiscard]]
+    auto match_empty_or_deleted() const noexcept -> ctrl_mask<std::uint64_t, 3> {
+        return {this->ctrl & ~(this->ctrl << 7) & msbs};
+    }
+
+  private:
+    static constexpr auto lsbs = std::uint64_t{0x0101'0101'0101'0101};
+    static constexpr auto msbs = std::uint64_t{0x8080'8080'8080'8080};
+
+    std::uint64_t ctrl;
+};
+
+#endif
+
+/// @brief Control bytes of tables which haven't allocated yet: a sentinel, so that iteration stops immediately,
+/// followed by empty bytes, so that lookups end after probing a single group. Never written to.
+alignas(ctrl_group::width) inline constinit auto empty_ctrl_group = [] {
+    auto group = std::array<ctrl_t, ctrl_group::width>{};
+    group.fill(ctrl_empty);
+    group[0] = ctrl_sentinel;
+    return group;
+}();
+
+/// @brief Mixes the bits of @p hash, so that hashes which only differ in their high bits, such as those of
+/// `std::hash` for integers, which is the identity, spread over both the slot index and the control byte.
+[[nodiscard]]
+constexpr auto mix_hash(std::size_t const hash) noexcept -> std::size_t {
+    auto const product = static_cast<std::uint64_t>(hash) * std::uint64_t{0x9E37'79B9'7F4A'7C15};
+    return static_cast<std::size_t>(product ^ (product >> 32));
+}
+
+} // namespace detail
+
+/// @brief Open-addressing hash map, after the design of Abseil's Swiss tables, whose elements are stored in place in
+/// an array of `maybe_uninit<std::pair<K, V>>` slots.
+/// @details Unlike `std::unordered_map`, inserting an element allocates no node, and empty slots are never
+/// constructed. Each slot has a control byte, stored in a separate array, which is either empty, deleted, or holds
+/// 7 bits of the hash of the key of the element. Lookups probe groups of 16 control bytes, compared against the hash
+/// in a few SSE2 instructions, or 8 bytes at a time with bitwise operations on other targets, and only compare keys
+/// of the slots whose control byte matches:
+/// @code {.cpp}
+///     auto sessions = flat_hash_map<std::uint64_t, Session>{};
+///     sessions.try_emplace(id, socket, now);
+///     if (auto it = sessions.find(id); it != sessions.end()) {
+///         it->second.touch(now);
+///     }
+/// @endcode
+/// The table holds up to 7/8 of its capacity, which is one less than a power of 2, and grows by rehashing every
+/// element into a table twice as large. Erased slots are marked deleted, and reclaimed by the next rehash.
+/// @tparam K Type of the keys.
+/// @tparam V Type of the mapped values.
+/// @tparam Hash Hash function of the keys. Mustn't throw, as rehashing hashes the elements while relocating them
+/// into the new table, which couldn't be undone.
+/// @tparam KeyEqual Equality comparison of the keys.
+/// @attention Elements are exposed as `std::pair<K, V>`, whose keys mustn't be modified. Iterators and references are
+/// invalidated by rehashes, i.e. by insertions which grow the table, and by `reserve()`.
+template <
+    detail::sized K,
+    detail::sized V,
+    typename Hash = std::hash<K>,
+    typename KeyEqual = std::equal_to<K>>
+    requires(detail::nothrow_relocatable<std::pair<K, V>> and std::is_nothrow_destructible_v<std::pair<K, V>>
+             and std::is_nothrow_invocable_v<Hash const&, K const&>)
+class flat_hash_map {
+    template <bool Const>
+    class basic_iterator;
+
+  public:
+    using key_type = K;
+    using mapped_type = V;
+    using value_type = std::pair<K, V>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using hasher = Hash;
+    using key_equal = KeyEqual;
+    using reference = value_type&;
+    using const_reference = value_type const&;
+    using iterator = basic_iterator<false>;
+    using const_iterator = basic_iterator<true>;
+
+    /// @brief Default constructor. Constructs an empty map, without allocating.
+    flat_hash_map() noexcept(std::is_nothrow_default_constructible_v<Hash>
+                             and std::is_nothrow_default_constructible_v<KeyEqual>) = default;
+
+    /// @brief Copy constructor. Copies the control bytes of @p other and copy constructs its elements in the same
+    /// slots, without rehashing them.
+    /// @note Propagates exceptions thrown by the copy constructors of the elements or by the allocator, after
+    /// releasing everything acquired so far.
+    flat_hash_map(flat_hash_map const& other)
+        requires std::copy_constructible<value_type>
+        : hash(other.hash)
+        , equal(other.equal) {
+        if (other.cap == 0) {
+            return;
+        }
+        this->allocate(other.cap);
+        try {
+            for (auto i = size_type{0}; i != other.cap; ++i) {
+                if (other.ctrl[i] >= 0) {
+                    this->slots[i].paren_init(other.slots[i].ref());
+                    this->set_ctrl(i, other.ctrl[i]);
+                    ++this->count;
+                } else if (other.ctrl[i] == detail::ctrl_deleted) {
+                    this->set_ctrl(i, detail::ctrl_deleted);
+                }
+            }
+        } catch (...) {
+            this->reset();
+            throw;
+        }
+        this->growth_left = other.growth_left;
+    }
+
+    /// @brief Move constructor. Steals the arrays of @p other, leaving it empty.
+    flat_hash_map(flat_hash_map&& other) noexcept
+        : ctrl(std::exchange(other.ctrl, detail::empty_ctrl_group.data()))
+        , slots(std::exchange(other.slots, nullptr))
+        , cap(std::exchange(other.cap, 0))
+        , count(std::exchange(other.count, 0))
+        , growth_left(std::exchange(other.growth_left, 0))
+        , hash(other.hash)
+        , equal(other.equal) {}
+
+    /// @brief Copy assignment operator. Copies @p other, then replaces the current elements with the copy.
+    /// @note Propagates exceptions thrown by the copy constructors of the elements or by the allocator, in which case
+    /// the map is left unchanged.
+    auto operator=(flat_hash_map const& other) -> flat_hash_map&
+        requires std::copy_constructible<value_type>
+    {
+        if (this != std::addressof(other)) {
+            *this = flat_hash_map(other);
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment operator. Releases the current elements, then steals the arrays of @p other, leaving it
+    /// empty.
+    auto operator=(flat_hash_map&& other) noexcept -> flat_hash_map& {
+        if (this != std::addressof(other)) {
+            this->reset();
+            this->ctrl = std::exchange(other.ctrl, detail::empty_ctrl_group.data());
+            this->slots = std::exchange(other.slots, nullptr);
+            this->cap = std::exchange(other.cap, 0);
+            this->count = std::exchange(other.count, 0);
+            this->growth_left = std::exchange(other.growth_left, 0);
+            this->hash = other.hash;
+            this->equal = other.equal;
+        }
+        return *this;
+    }
+
+    /// @brief Destructor. Destroys every element and releases the arrays.
+    ~flat_hash_map() {
+        this->reset();
+    }
+
+    /// @brief Returns the number of elements.
+    [[nodiscard]]
+    auto size() const noexcept -> size_type {
+        return this->count;
+    }
+
+    /// @brief Returns whether the map holds no elements.
+    [[nodiscard]]
+    auto empty() const noexcept -> bool {
+        return this->count == 0;
+    }
+
+    /// @brief Returns the number of slots.
+    [[nodiscard]]
+    auto capacity() const noexcept -> size_type {
+        return this->cap;
+    }
+
+    /// @brief Returns the largest number of elements the map can hold.
+    [[nodiscard]]
+    static constexpr auto max_size() noexcept -> size_type {
+        return capacity_to_growth(max_capacity);
+    }
+
+    /// @brief Returns an iterator to the first element, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    auto begin(this Self&& self) noexcept {
+        return self.iterator_at(0, skip_empty);
+    }
+
+    /// @brief Returns an iterator past the last element, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    auto end(this Self&& self) noexcept {
+        return self.iterator_at(self.cap);
+    }
+
+    /// @brief Returns an iterator to the element whose key is equivalent to @p key, or `end()` if there's none,
+    /// preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    auto find(this Self&& self, K const& key) {
+        return self.iterator_at(self.find_index(key, self.hash_of(key)));
+    }
+
+    /// @brief Returns whether an element's key is equivalent to @p key.
+    [[nodiscard]]
+    auto contains(K const& key) const -> bool {
+        return this->find_index(key, this->hash_of(key)) != this->cap;
+    }
+
+    /// @brief Returns the value mapped to @p key, preserving the constness of @p self.
+    /// @note Throws `std::out_of_range` if no element's key is equivalent to @p key.
+    template <typename Self>
+    [[nodiscard]]
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    auto at(this Self&& self, K const& key) -> auto& {
+        auto const index = self.find_index(key, self.hash_of(key));
+        if (index == self.cap) {
+            throw std::out_of_range("flat_hash_map::at: key not found");
+        }
+        using mapped_reference = std::conditional_t<detail::const_ref<Self>, V const&, V&>;
+        return static_cast<mapped_reference>(self.slots[index].ref().second);
+    }
+
+    /// @brief Returns the value mapped to @p key, inserting a value-initialized one if there's none.
+    auto operator[](K const& key) -> V&
+        requires(std::copy_constructible<K> and detail::paren_constructible_from<V>)
+    {
+        return this->try_emplace(key).first->second;
+    }
+
+    /// @brief Returns the value mapped to @p key, inserting a value-initialized one if there's none.
+    auto operator[](K&& key) -> V&
+        requires(std::move_constructible<K> and detail::paren_constructible_from<V>)
+    {
+        return this->try_emplace(std::move(key)).first->second;
+    }
+
+    /// @brief If no element's key is equivalent to @p key, inserts an element whose key is copy constructed from
+    /// @p key and whose value is constructed as if by `V(std::forward<Args>(args)...)`.
+    /// @returns An iterator to the element whose key is equivalent to @p key, and whether it was inserted.
+    /// @note @p key and @p args may refer to elements of the map.
+    /// @note Throws `std::length_error` if the map must grow past `max_size()` elements.
+    /// @note Propagates exceptions thrown by the constructors of the element or by the allocator, in which case
+    /// nothing is inserted.
+    template <typename... Args>
+    auto try_emplace(K const& key, Args&&... args) -> std::pair<iterator, bool>
+        requires(std::copy_constructible<K> and detail::paren_constructible_from<V, Args...>)
+    {
+        return this->emplace_unique(key, std::forward<Args>(args)...);
+    }
+
+    /// @brief If no element's key is equivalent to @p key, inserts an element whose key is move constructed from
+    /// @p key and whose value is constructed as if by `V(std::forward<Args>(args)...)`.
+    /// @returns An iterator to the element whose key is equivalent to @p key, and whether it was inserted.
+    /// @note @p key and @p args may refer to elements of the map.
+    /// @note Throws `std::length_error` if the map must grow past `max_size()` elements.
+    /// @note Propagates exceptions thrown by the constructors of the element or by the allocator, in which case
+    /// nothing is inserted.
+    template <typename... Args>
+    auto try_emplace(K&& key, Args&&... args) -> std::pair<iterator, bool>
+        requires(std::move_constructible<K> and detail::paren_constructible_from<V, Args...>)
+    {
+        return this->emplace_unique(std::move(key), std::forward<Args>(args)...);
+    }
+
+    /// @brief Inserts a copy of @p value if no element's key is equivalent to its key.
+    /// @returns An iterator to the element whose key is equivalent to the key of @p value, and whether it was
+    /// inserted.
+    auto insert(value_type const& value) -> std::pair<iterator, bool>
+        requires std::copy_constructible<value_type>
+    {
+        return this->emplace_unique(value.first, value.second);
+    }
+
+    /// @brief Moves @p value into the map if no element's key is equivalent to its key.
+    /// @returns An iterator to the element whose key is equivalent to the key of @p value, and whether it was
+    /// inserted.
+    auto insert(value_type&& value) -> std::pair<iterator, bool>
+        requires std::move_constructible<value_type>
+    {
+        return this->emplace_unique(std::move(value.first), std::move(value.second));
+    }
+
+    /// @brief Assigns @p value to the value mapped to @p key, inserting it if there's none.
+    /// @returns An iterator to the element whose key is equivalent to @p key, and whether it was inserted.
+    /// @note @p key and @p value may refer to elements of the map.
+    template <typename M>
+    auto insert_or_assign(K const& key, M&& value) -> std::pair<iterator, bool>
+        requires(std::copy_constructible<K> and std::is_assignable_v<V&, M> and detail::paren_constructible_from<V, M>)
+    {
+        auto result = this->emplace_unique(key, std::forward<M>(value));
+        if (not result.second) {
+            result.first->second = std::forward<M>(value);
+        }
+        return result;
+    }
+
+    /// @brief Destroys the element pointed to by @p pos, marking its slot deleted.
+    /// @pre @p pos points to an element of the map.
+    auto erase(const_iterator const pos) noexcept {
+        this->erase_at(static_cast<size_type>(pos.ctrl - this->ctrl));
+    }
+
+    /// @brief Destroys the element whose key is equivalent to @p key, if any.
+    /// @returns The number of elements erased, i.e. `0` or `1`.
+    auto erase(K const& key) -> size_type {
+        auto const index = this->find_index(key, this->hash_of(key));
+        if (index == this->cap) {
+            return 0;
+        }
+        this->erase_at(index);
+        return 1;
+    }
+
+    /// @brief Destroys every element. The capacity is left unchanged.
+    auto clear() noexcept {
+        if (this->cap == 0) {
+            return;
+        }
+        this->destroy_elements();
+        this->reset_ctrl();
+        this->count = 0;
+    }
+
+    /// @brief Ensures the map can hold at least @p n elements without rehashing, rehashing it if needed.
+    /// @note Throws `std::length_error` if @p n exceeds `max_size()`.
+    /// @note Propagates exceptions thrown by the allocator, in which case the map is left unchanged.
+    auto reserve(size_type const n) {
+        if (n <= this->count + this->growth_left) {
+            return;
+        }
+        if (n > max_size()) {
+            throw std::length_error("flat_hash_map::reserve");
+        }
+        auto new_cap = ctrl_width - 1;
+        while (capacity_to_growth(new_cap) < n) {
+            new_cap = new_cap * 2 + 1;
+        }
+        // If the capacity suffices, deleted slots are what's in the way, and rehashing in place drops them.
+        this->rehash(std::max(new_cap, this->cap));
+    }
+
+  private:
+    using slot_type = maybe_uninit<value_type>;
+
+    static constexpr auto ctrl_width = detail::ctrl_group::width;
+
+    /// @brief Largest capacity, one less than a power of 2, whose slots fit in an allocation.
+    static constexpr auto max_capacity =
+        std::bit_floor(static_cast<size_type>(std::numeric_limits<difference_type>::max()) / sizeof(slot_type) + 1)
+        - 1;
+
+    /// @brief Tag telling `iterator_at()` to skip empty and deleted slots.
+    static constexpr struct skip_empty_t {
+    } skip_empty{};
+
+    /// @brief Forward iterator over the elements of a `flat_hash_map`.
+    template <bool Const>
+    class basic_iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = flat_hash_map::value_type;
+        using difference_type = std::ptrdiff_t;
+        using reference = std::conditional_t<Const, value_type const&, value_type&>;
+        using pointer = std::conditional_t<Const, value_type const*, value_type*>;
+
+        /// @brief Default constructor. Constructs a singular iterator.
+        basic_iterator() noexcept = default;
+
+        /// @brief Converts a mutable iterator into a constant one.
+        template <bool OtherConst>
+            requires(Const and not OtherConst)
+        // NOLINTNEXTLINE(google-explicit-constructor)
+        basic_iterator(basic_iterator<OtherConst> const& other) noexcept
+            : ctrl(other.ctrl)
+            , slot(other.slot) {}
+
+        [[nodiscard]]
+        auto operator*() const noexcept -> reference {
+            return this->slot->ref();
+        }
+
+        [[nodiscard]]
+        auto operator->() const noexcept -> pointer {
+            return this->slot->ptr();
+        }
+
+        auto operator++() noexcept -> basic_iterator& {
+            ++this->ctrl;
+            ++this->slot;
+            this->skip_empty_or_deleted();
+            return *this;
+        }
+
+        auto operator++(int) noexcept -> basic_iterator {
+            auto copy = *this;
+            ++*this;
+            return copy;
+        }
+
+        [[nodiscard]]
+        friend auto operator==(basic_iterator const& lhs, basic_iterator const& rhs) noexcept -> bool {
+            return lhs.ctrl == rhs.ctrl;
+        }
+
+      private:
+        friend flat_hash_map;
+
+        template <bool>
+        friend class basic_iterator;
+
+        basic_iterator(detail::ctrl_t const* const ctrl, slot_type* const slot) noexcept
+            : ctrl(ctrl)
+            , slot(slot) {}
+
+        /// @brief Advances to the next full slot, or to the sentinel.
+        auto skip_empty_or_deleted() noexcept {
+            while (*this->ctrl < detail::ctrl_sentinel) {
+                ++this->ctrl;
+                ++this->slot;
+            }
+        }
+
+        detail::ctrl_t const* ctrl = nullptr;
+        slot_type* slot = nullptr;
+    };
+
+    /// @brief Probe sequence over the groups of a table, visiting group starts `h1`, `h1 + width`,
+    /// `h1 + 3 * width`, ..., modulo the capacity plus 1, which visits every group as that's a power of 2.
+    struct probe_sequence {
+        probe_sequence(std::size_t const h1, std::size_t const mask) noexcept
+            : offset(h1 & mask)
+            , mask(mask) {}
+
+        /// @brief Returns the index of the slot @p i slots past the start of the current group.
+        [[nodiscard]]
+        auto slot(std::size_t const i) const noexcept -> std::size_t {
+            return (this->offset + i) & this->mask;
+        }
+
+        auto next() noexcept {
+            this->index += ctrl_width;
+            this->offset = (this->offset + this->index) & this->mask;
+        }
+
+        std::size_t offset;
+        std::size_t mask;
+        std::size_t index = 0;
+    };
+
+    /// @brief Returns the number of elements a table of @p cap slots holds before growing, i.e. 7/8 of them, leaving
+    /// at least one slot empty so that probe sequences end.
+    static constexpr auto capacity_to_growth(size_type const cap) noexcept -> size_type {
+        return std::min(cap - cap / 8, cap - 1);
+    }
+
+    /// @brief Returns the control byte of a full slot whose key has the mixed hash @p hash.
+    static constexpr auto h2(std::size_t const hash) noexcept -> detail::ctrl_t {
+        return static_cast<detail::ctrl_t>(hash & 0x7F);
+    }
+
+    /// @brief Returns the mixed hash of @p key.
+    [[nodiscard]]
+    auto hash_of(K const& key) const noexcept -> std::size_t {
+        return detail::mix_hash(std::invoke(this->hash, key));
+    }
+
+    /// @brief Returns an iterator to the slot at @p index, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    auto iterator_at(this Self&& self, size_type const index) noexcept {
+        using iterator_type = std::conditional_t<detail::const_ref<Self>, const_iterator, iterator>;
+        return iterator_type(self.ctrl + index, self.slots + index);
+    }
+
+    /// @brief Returns an iterator to the first full slot starting at @p index, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    auto iterator_at(this Self&& self, size_type const index, skip_empty_t) noexcept {
+        auto it = self.iterator_at(index);
+        it.skip_empty_or_deleted();
+        return it;
+    }
+
+    /// @brief Returns the index of the slot of the element whose key is equivalent to @p key, whose mixed hash is
+    /// @p hash, or `cap` if there's none.
+    [[nodiscard]]
+    auto find_index(K const& key, std::size_t const hash) const -> size_type {
+        auto seq = probe_sequence(hash >> 7, this->cap);
+        while (true) {
+            auto const group = detail::ctrl_group(this->ctrl + seq.offset);
+            for (auto match = group.match(h2(hash)); match; match.clear_lowest()) {
+                auto const index = seq.slot(match.lowest());
+                if (std::invoke(this->equal, this->slots[index].ref().first, key)) [[likely]] {
+                    return index;
+                }
+            }
+            if (group.match_empty()) [[likely]] {
+                return this->cap;
+            }
+            seq.next();
+        }
+    }
+
+    /// @brief Returns the index of the first empty or deleted slot in the probe sequence of the mixed hash @p hash.
+    /// @pre The table has an empty slot.
+    [[nodiscard]]
+    auto find_first_non_full(std::size_t const hash) const noexcept -> size_type {
+        auto seq = probe_sequence(hash >> 7, this->cap);
+        while (true) {
+            auto const match = detail::ctrl_group(this->ctrl + seq.offset).match_empty_or_deleted();
+            if (match) [[likely]] {
+                return seq.slot(match.lowest());
+            }
+            seq.next();
+        }
+    }
+
+    /// @brief Inserts an element constructed from @p key and @p args if no element's key is equivalent to @p key.
+    /// @details If the table must grow, the element is constructed before rehashing, then relocated into its slot, as
+    /// @p key and @p args may refer to elements of the map, which rehashing relocates.
+    template <typename KeyArg, typename... Args>
+    auto emplace_unique(KeyArg&& key, Args&&... args) -> std::pair<iterator, bool> {
+        auto const hash = this->hash_of(key);
+        if (auto const index = this->find_index(key, hash); index != this->cap) {
+            return {this->iterator_at(index), false};
+        }
+        auto index = size_type{0};
+        if (this->growth_left == 0) [[unlikely]] {
+            auto element = slot_type(
+                paren_init_t{},
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<KeyArg>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...)
+            );
+            try {
+                this->rehash_for_insertion();
+            } catch (...) {
+                element.destroy();
+                throw;
+            }
+            index = this->find_first_non_full(hash);
+            element.relocate_into(this->slots[index]);
+        } else {
+            index = this->find_first_non_full(hash);
+            this->slots[index].paren_init(
+                std::piecewise_construct,
+                std::forward_as_tuple(std::forward<KeyArg>(key)),
+                std::forward_as_tuple(std::forward<Args>(args)...)
+            );
+        }
+        this->growth_left -= static_cast<size_type>(this->ctrl[index] == detail::ctrl_empty);
+        this->set_ctrl(index, h2(hash));
+        ++this->count;
+        return {this->iterator_at(index), true};
+    }
+
+    /// @brief Makes room for an insertion, by rehashing into a table twice as large, or into a table of the same
+    /// capacity if deleted slots make up much of it.
+    /// @note Throws `std::length_error` if the table can't grow past `max_capacity`.
+    auto rehash_for_insertion() {
+        if (this->cap == 0) {
+            this->rehash(ctrl_width - 1);
+        } else if (this->cap > ctrl_width and this->count * 32 <= this->cap * 25) {
+            this->rehash(this->cap);
+        } else if (this->cap == max_capacity) {
+            throw std::length_error("flat_hash_map");
+        } else {
+            this->rehash(this->cap * 2 + 1);
+        }
+    }
+
+    /// @brief Relocates every element into new arrays of @p new_cap slots, dropping deleted slots.
+    /// @note Propagates exceptions thrown by the allocator, in which case the map is left unchanged.
+    auto rehash(size_type const new_cap) {
+        auto* const old_ctrl = this->ctrl;
+        auto* const old_slots = this->slots;
+        auto const old_cap = this->cap;
+        this->allocate(new_cap);
+        for (auto i = size_type{0}; i != old_cap; ++i) {
+            if (old_ctrl[i] >= 0) {
+                auto const hash = this->hash_of(old_slots[i].ref().first);
+                auto const index = this->find_first_non_full(hash);
+                old_slots[i].relocate_into(this->slots[index]);
+                this->set_ctrl(index, h2(hash));
+            }
+        }
+        this->growth_left -= this->count;
+        if (old_cap != 0) {
+            deallocate(old_ctrl, old_slots, old_cap);
+        }
+    }
+
+    /// @brief Allocates arrays of @p new_cap slots, all empty, and adopts them in place of the current ones, which
+    /// the caller releases.
+    /// @note Propagates exceptions thrown by the allocator, in which case the map is left unchanged.
+    auto allocate(size_type const new_cap) {
+        auto* const new_ctrl = std::allocator<detail::ctrl_t>().allocate(new_cap + ctrl_width);
+        try {
+            this->slots = std::allocator<slot_type>().allocate(new_cap);
+        } catch (...) {
+            std::allocator<detail::ctrl_t>().deallocate(new_ctrl, new_cap + ctrl_width);
+            throw;
+        }
+        this->ctrl = new_ctrl;
+        this->cap = new_cap;
+        this->reset_ctrl();
+    }
+
+    /// @brief Releases the arrays @p ctrl and @p slots of a table of @p cap slots.
+    static auto deallocate(detail::ctrl_t* const ctrl, slot_type* const slots, size_type const cap) noexcept {
+        std::allocator<detail::ctrl_t>().deallocate(ctrl, cap + ctrl_width);
+        std::allocator<slot_type>().deallocate(slots, cap);
+    }
+
+    /// @brief Marks every slot empty, without destroying any element.
+    auto reset_ctrl() noexcept {
+        std::memset(this->ctrl, detail::ctrl_empty, this->cap + ctrl_width);
+        this->ctrl[this->cap] = detail::ctrl_sentinel;
+        this->growth_left = capacity_to_growth(this->cap);
+    }
+
+    /// @brief Sets the control byte of the slot at @p index to @p h, along with its clone past the sentinel, so that
+    /// groups starting at any slot can be loaded without wrapping around.
+    auto set_ctrl(size_type const index, detail::ctrl_t const h) noexcept {
+        this->ctrl[index] = h;
+        this->ctrl[((index - (ctrl_width - 1)) & this->cap) + (ctrl_width - 1)] = h;
+    }
+
+    /// @brief Destroys the element at @p index, marking its slot deleted.
+    auto erase_at(size_type const index) noexcept {
+        this->slots[index].destroy();
+        this->set_ctrl(index, detail::ctrl_deleted);
+        --this->count;
+    }
+
+    /// @brief Destroys every element, leaving their control bytes unchanged.
+    auto destroy_elements() noexcept {
+        if constexpr (not std::is_trivially_destructible_v<value_type>) {
+            for (auto i = size_type{0}; i != this->cap; ++i) {
+                if (this->ctrl[i] >= 0) {
+                    this->slots[i].destroy();
+                }
+            }
+        }
+    }
+
+    /// @brief Destroys every element and releases the arrays.
+    auto reset() noexcept {
+        if (this->cap == 0) {
+            return;
+        }
+        this->destroy_elements();
+        deallocate(this->ctrl, this->slots, this->cap);
+        this->ctrl = detail::empty_ctrl_group.data();
+        this->slots = nullptr;
+        this->cap = 0;
+        this->count = 0;
+        this->growth_left = 0;
+    }
+
+    /// @brief The control bytes: `cap` bytes, the sentinel, then clones of the first `ctrl_width - 1` bytes. Points to
+    /// `detail::empty_ctrl_group` until the map allocates.
+    detail::ctrl_t* ctrl = detail::empty_ctrl_group.data();
+
+    /// @brief The slots, constructed where their control byte is full, or `nullptr` until the map allocates.
+    slot_type* slots = nullptr;
+
+    /// @brief Number of slots, which is either `0` or one less than a power of 2, used as a mask.
+    size_type cap = 0;
+
+    /// @brief Number of elements.
+    size_type count = 0;
+
+    /// @brief Number of elements which can be inserted in empty slots before rehashing.
+    size_type growth_left = 0;
+
+    [[no_unique_address]] Hash hash{};
+    [[no_unique_address]] KeyEqual equal{};
+};
+
+} // namespace MAYBE_UNINIT_NAMESPACE
@@ -0,0 +1,131 @@
+/// @file
+/// @brief Benchmarks `flat_hash_map` against `std::unordered_map`. Not part of the library: compile it on its own, with
+/// optimizations, e.g. with `c++ -std=c++26 -O2 -DNDEBUG flat_hash_map_bench.cpp -o flat_hash_map_bench`.
+/// @details Each map, from `std::uint64_t` keys to `std::uint64_t` values, is measured at sizes from 1,000 keys up to
+/// 100 million keys, or up to the number of keys given as the first argument, on three workloads:
+/// - `insert`: inserting every key into an empty map, without reserving;
+/// - `hit`: looking up every key of a full map;
+/// - `miss`: looking up as many keys which aren't in the map.
+///
+/// Keys are scattered by a bijective mix, so that inserted and missing keys never collide. Times are the best of
+/// several runs, in nanoseconds per key. Small sizes are repeated so that each run processes a comparable number of
+/// keys. The largest size needs several GiB of memory. Requires GCC or Clang, for the inline assembly which keeps the
+/// compiler from discarding the work.
+
+#include "flat_hash_map.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+namespace flat_hash_map_bench {
+
+using namespace MAYBE_UNINIT_NAMESPACE;
+
+/// @brief Default largest number of keys.
+inline constexpr auto max_key_count = std::size_t{100'000'000};
+
+/// @brief Number of keys processed per run, by repeating the workload on small maps.
+inline constexpr auto keys_per_run = std::size_t{10'000'000};
+
+/// @brief Number of runs, of which the fastest is reported.
+inline constexpr auto runs = 5;
+
+/// @brief Makes the compiler assume @p value is read and written, so that the work producing it isn't discarded.
+template <typename T>
+auto clobber(T& value) noexcept {
+    asm volatile("" : : "g"(std::addressof(value)) : "memory");
+}
+
+/// @brief Returns the @p i-th key, scattered by splitmix64's finalizer, which is a bijection.
+constexpr auto key_at(std::uint64_t i) noexcept -> std::uint64_t {
+    i = (i ^ (i >> 30)) * std::uint64_t{0xBF58'476D'1CE4'E5B9};
+    i = (i ^ (i >> 27)) * std::uint64_t{0x94D0'49BB'1331'11EB};
+    return i ^ (i >> 31);
+}
+
+/// @brief Returns the fastest of `runs` runs of @p workload, which processes @p key_count keys, in nanoseconds per key.
+template <typename F>
+auto measure(std::size_t const key_count, F workload) -> double {
+    auto best = std::chrono::nanoseconds::max();
+    for (auto run = 0; run != runs; ++run) {
+        auto const start = std::chrono::steady_clock::now();
+        workload();
+        auto const elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed));
+    }
+    return static_cast<double>(best.count()) / static_cast<double>(key_count);
+}
+
+/// @brief Returns the sum of the values mapped to @p keys in @p map, skipping missing ones.
+template <typename Map>
+auto lookup(Map const& map, std::vector<std::uint64_t> const& keys) -> std::uint64_t {
+    auto sum = std::uint64_t{0};
+    for (auto const key : keys) {
+        if (auto const it = map.find(key); it != map.end()) {
+            sum += it->second;
+        }
+    }
+    return sum;
+}
+
+/// @brief Measures the workloads on a `Map` of @p keys, looking up @p missing_keys as misses, and prints the results.
+template <typename Map>
+auto run(
+    char const* const map_name,
+    std::vector<std::uint64_t> const& keys,
+    std::vector<std::uint64_t> const& missing_keys
+) {
+    auto const repetitions = std::max(keys_per_run / keys.size(), std::size_t{1});
+    auto const key_count = repetitions * keys.size();
+    auto const insert = measure(key_count, [&] {
+        for (auto r = std::size_t{0}; r != repetitions; ++r) {
+            auto map = Map();
+            for (auto const key : keys) {
+                map.try_emplace(key, key);
+            }
+            clobber(map);
+        }
+    });
+    auto map = Map();
+    for (auto const key : keys) {
+        map.try_emplace(key, key);
+    }
+    auto const hit = measure(key_count, [&] {
+        for (auto r = std::size_t{0}; r != repetitions; ++r) {
+            auto sum = lookup(map, keys);
+            clobber(sum);
+        }
+    });
+    auto const miss = measure(key_count, [&] {
+        for (auto r = std::size_t{0}; r != repetitions; ++r) {
+            auto sum = lookup(map, missing_keys);
+            clobber(sum);
+        }
+    });
+    std::printf("%12zu %-20s %10.2f %10.2f %10.2f\n", keys.size(), map_name, insert, hit, miss);
+}
+
+} // namespace flat_hash_map_bench
+
+int main(int const argc, char** const argv) {
+    using namespace flat_hash_map_bench;
+    auto const max_keys = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : max_key_count;
+    std::printf("%12s %-20s %10s %10s %10s  (ns/key)\n", "keys", "map", "insert", "hit", "miss");
+    for (auto n = std::size_t{1'000}; n <= max_keys; n *= 10) {
+        auto keys = std::vector<std::uint64_t>(n);
+        auto missing_keys = std::vector<std::uint64_t>(n);
+        for (auto i = std::size_t{0}; i != n; ++i) {
+            keys[i] = key_at(i);
+            missing_keys[i] = key_at(n + i);
+        }
+        run<flat_hash_map<std::uint64_t, std::uint64_t>>("flat_hash_map", keys, missing_keys);
+        run<std::unordered_map<std::uint64_t, std::uint64_t>>("std::unordered_map", keys, missing_keys);
+    }
+}
@@ -0,0 +1,177 @@
+/// @file
+/// @brief Defines the template type `global`, `constinit` storage for globals which are initialized explicitly and
+/// destroyed in reverse order at exit, and `destroy_globals()`, which destroys them earlier.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <atomic>
+#include <cstdlib>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+namespace detail {
+
+/// @brief Link of the registry of initialized `global`s.
+struct global_node {
+    /// @brief Destroys the object of the `global` this node is the base of.
+    void (*destroy)(global_node&) noexcept;
+
+    /// @brief Previously initialized `global`.
+    global_node* next = nullptr;
+};
+
+/// @brief Head of the registry, i.e. the most recently initialized `global`.
+inline constinit auto global_registry = std::atomic<global_node*>(nullptr);
+
+/// @brief Whether `destroy_global_registry()` is registered with `std::atexit()`.
+inline constinit auto global_registry_teardown = std::atomic<bool>(false);
+
+/// @brief Destroys the objects of the `global`s in the registry, from the most recently initialized one, and empties
+/// it.
+inline auto destroy_global_registry() noexcept {
+    auto* node = global_registry.exchange(nullptr, std::memory_order_acquire);
+    while (node != nullptr) {
+        auto* const next = node->next;
+        node->destroy(*node);
+        node = next;
+    }
+}
+
+/// @brief Registers `destroy_global_registry()` with `std::atexit()`, unless it's already registered.
+inline auto register_global_registry_teardown() noexcept {
+    if (not global_registry_teardown.load(std::memory_order_relaxed)
+        and not global_registry_teardown.exchange(true, std::memory_order_relaxed)) {
+        static_cast<void>(std::atexit(destroy_global_registry));
+    }
+}
+
+} // namespace detail
+
+/// @brief Storage for a global object which is constructed when `init()` is called rather than before `main()`, and
+/// destroyed at exit, or earlier by `destroy_globals()`.
+/// @details The constructor is `constexpr` and constructs no object, so `global`s are `constinit` and cost nothing
+/// during static initialization, regardless of `T`. Objects can then be initialized in explicit phases, in an order
+/// that respects their dependencies, and independent ones can be initialized in parallel, as `init()` may be called on
+/// distinct `global`s from different threads:
+/// @code {.cpp}
+///     constinit auto logger = global<Logger>{};
+///     constinit auto database = global<Database>{};
+///     constinit auto cache = global<Cache>{};
+///
+///     int main() {
+///         logger.init(std::clog);                        // phase 1.
+///         pool.run({                                     // phase 2, in parallel.
+///             [] { database.init(*logger, "db.sqlite"); },
+///             [] { cache.init(*logger, 1 << 20); },
+///         });
+///         // ...
+///     }                                                  // at exit, destroys cache and database, then logger.
+/// @endcode
+/// Each initialized `global` is pushed onto a lock-free registry, which is unwound at exit by a function registered
+/// with `std::atexit()` upon the first `init()`, so objects are destroyed in the reverse order of the completion of
+/// their initialization. Calling `destroy_globals()` unwinds it earlier, e.g. before threads using the globals are
+/// detached, or between tests.
+/// @tparam T Type of the object.
+/// @attention Accesses to a `global` must be ordered after its `init()`, e.g. by joining the threads of the phase which
+/// initialized it, and before its destruction, i.e. `destroy_globals()` or the return from `main()`.
+template <detail::sized T>
+    requires std::is_nothrow_destructible_v<T>
+class global : detail::global_node {
+  public:
+    /// @brief Default constructor. Performs no initialization on the object.
+    constexpr global() noexcept
+        : detail::global_node{&global::destroy_object} {}
+
+    global(global const&) = delete;
+    global(global&&) = delete;
+    auto operator=(global const&) -> global& = delete;
+    auto operator=(global&&) -> global& = delete;
+
+    /// @brief Initializes the object as if by `T(std::forward<Args>(args)...)`, and registers it for destruction at
+    /// exit or by `destroy_globals()`.
+    /// @returns A reference to the constructed object.
+    /// @pre The object isn't constructed.
+    /// @note Propagates exceptions thrown by `T`'s selected constructor, in which case nothing is registered.
+    template <typename... Args>
+    auto init(Args&&... args) noexcept(detail::nothrow_paren_constructible_from<T, Args...>) -> T&
+        requires detail::paren_constructible_from<T, Args...>
+    {
+        auto& object = this->storage.paren_init(std::forward<Args>(args)...);
+        this->initialized = true;
+        this->next = detail::global_registry.load(std::memory_order_relaxed);
+        while (not detail::global_registry.compare_exchange_weak(
+            this->next,
+            this,
+            std::memory_order_release,
+            std::memory_order_relaxed
+        )) {}
+        detail::register_global_registry_teardown();
+        return object;
+    }
+
+    /// @brief Returns whether the object is constructed.
+    [[nodiscard]]
+    auto is_initialized() const noexcept -> bool {
+        return this->initialized;
+    }
+
+    /// @brief Returns a reference to the object, preserving the constness of @p self.
+    /// @pre The object is constructed. Checked if `MAYBE_UNINIT_CHECKED` is enabled.
+    template <typename Self>
+    [[nodiscard]]
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    auto get(this Self&& self) noexcept -> auto& {
+#if MAYBE_UNINIT_CHECKED
+        if (not self.initialized) {
+            MAYBE_UNINIT_CHECK_FAILED("global accessed before being initialized");
+        }
+#endif
+        return self.storage.ref();
+    }
+
+    /// @brief Returns a reference to the object, preserving the constness of @p self.
+    /// @pre The object is constructed.
+    template <typename Self>
+    [[nodiscard]]
+    auto operator*(this Self&& self) noexcept -> auto& {
+        return std::forward<Self>(self).get();
+    }
+
+    /// @brief Returns a pointer to the object, preserving the constness of @p self.
+    /// @pre The object is constructed.
+    template <typename Self>
+    [[nodiscard]]
+    auto operator->(this Self&& self) noexcept -> auto* {
+        return std::addressof(std::forward<Self>(self).get());
+    }
+
+  private:
+    /// @brief Destroys the object of the `global` whose base is @p node.
+    static auto destroy_object(detail::global_node& node) noexcept {
+        auto& self = static_cast<global&>(node);
+        self.storage.destroy();
+        self.initialized = false;
+    }
+
+    /// @brief The object, constructed while `initialized` is `true`.
+    maybe_uninit<T> storage{};
+
+    /// @brief Whether the object is constructed.
+    bool initialized = false;
+};
+
+/// @brief Destroys the objects of every initialized `global`, in the reverse order of their initialization, leaving
+/// them uninitialized, before exit would. Globals may then be initialized again, e.g. between tests, and are then
+/// destroyed at exit.
+/// @pre No thread is accessing or initializing a `global`.
+/// @relatedalso global
+inline auto destroy_globals() noexcept {
+    detail::destroy_global_registry();
+}
+
+} // namespace MAYBE_UNINIT_NAMESPACE
@@ -0,0 +1,321 @@
+/// @file
+/// @brief Defines the template type `inplace_any`, a type-erased value which is stored in a fixed-size `maybe_uninit`
+/// buffer and never allocates.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <any>
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+/// @brief Type-erased copyable value, like `std::any`, stored in a buffer of `Size` bytes inside the wrapper rather
+/// than on the heap.
+/// @details Values are constructed in a `maybe_uninit` byte buffer, and are copied, relocated and destroyed through a
+/// static table of operations, one per value type, whose address also identifies the type for `any_cast`. Types which
+/// don't fit in the buffer, or whose alignment the buffer can't honor, are rejected at compile time instead of falling
+/// back to the heap:
+/// @code {.cpp}
+///     auto attributes = std::flat_map<attribute_id, inplace_any<16>>{};
+///     attributes[priority].emplace<int>(3);
+///     attributes[received_at].emplace<std::chrono::steady_clock::time_point>(now);
+///
+///     if (auto const* p = any_cast<int>(&attributes[priority])) {
+///         schedule(*p);
+///     }
+/// @endcode
+/// Trivially copyable values, and empty wrappers, are copied and moved with a `memcpy` of the buffer and never
+/// destroyed, without any indirect call. Other values must be nothrow relocatable, so that moving an `inplace_any`
+/// can't throw.
+/// @tparam Size Size of the buffer, in bytes.
+/// @tparam Align Alignment of the buffer.
+template <std::size_t Size = 4 * sizeof(void*), std::size_t Align = alignof(std::max_align_t)>
+    requires(Size != 0 and std::has_single_bit(Align))
+class inplace_any {
+    /// @brief Matches value types which can be stored in the buffer.
+    template <typename T>
+    static constexpr bool storable = std::is_object_v<T> and not std::is_const_v<T> and std::is_copy_constructible_v<T>
+                                 and detail::fits_in<T, Size, Align> and detail::nothrow_relocatable<T>;
+
+  public:
+    /// @brief Default constructor. Constructs an empty wrapper.
+    inplace_any() noexcept = default;
+
+    /// @brief Stores a value move or copy constructed from @p value.
+    /// @note Propagates exceptions thrown by the constructor of the value, in which case the wrapper is empty.
+    template <typename T>
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    inplace_any(T&& value) noexcept(std::is_nothrow_constructible_v<std::decay_t<T>, T>)
+        requires(not std::is_same_v<std::remove_cvref_t<T>, inplace_any> and storable<std::decay_t<T>>
+                 and std::is_constructible_v<std::decay_t<T>, T>)
+    {
+        this->construct<std::decay_t<T>>(std::forward<T>(value));
+    }
+
+    /// @brief Stores a value of type `T` constructed as if by `T(std::forward<Args>(args)...)`.
+    /// @note Propagates exceptions thrown by `T`'s selected constructor, in which case the wrapper is empty.
+    template <typename T, typename... Args>
+    explicit inplace_any(std::in_place_type_t<T>, Args&&... args) noexcept(
+        detail::nothrow_paren_constructible_from<T, Args...>
+    )
+        requires(storable<T> and detail::paren_constructible_from<T, Args...>)
+    {
+        this->construct<T>(std::forward<Args>(args)...);
+    }
+
+    /// @brief Copy constructor. Copy constructs the value of @p other, if any.
+    /// @note Propagates exceptions thrown by the copy constructor of the value, in which case the wrapper is empty.
+    inplace_any(inplace_any const& other) {
+        if (other.ops->trivial) {
+            this->copy_buffer(other);
+        } else {
+            other.ops->copy(other.storage(), this->storage());
+        }
+        this->ops = other.ops;
+    }
+
+    /// @brief Move constructor. Relocates the value of @p other, leaving it empty.
+    inplace_any(inplace_any&& other) noexcept {
+        this->steal(other);
+    }
+
+    /// @brief Copy assignment operator. Destroys the current value, then copy constructs the value of @p other.
+    /// @note Propagates exceptions thrown by the copy constructor of the value, in which case the wrapper is left
+    /// unchanged.
+    auto operator=(inplace_any const& other) -> inplace_any& {
+        if (this != std::addressof(other)) {
+            *this = inplace_any(other);
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment operator. Destroys the current value, then relocates the value of @p other, leaving it
+    /// empty.
+    auto operator=(inplace_any&& other) noexcept -> inplace_any& {
+        if (this != std::addressof(other)) {
+            this->reset();
+            this->steal(other);
+        }
+        return *this;
+    }
+
+    /// @brief Destroys the current value, then stores a value move or copy constructed from @p value.
+    /// @note Propagates exceptions thrown by the constructor of the value, in which case the wrapper is empty.
+    template <typename T>
+    auto operator=(T&& value) noexcept(std::is_nothrow_constructible_v<std::decay_t<T>, T>) -> inplace_any&
+        requires(not std::is_same_v<std::remove_cvref_t<T>, inplace_any> and storable<std::decay_t<T>>
+                 and std::is_constructible_v<std::decay_t<T>, T>)
+    {
+        this->reset();
+        this->construct<std::decay_t<T>>(std::forward<T>(value));
+        return *this;
+    }
+
+    /// @brief Destructor. Destroys the value, if any.
+    ~inplace_any() {
+        this->reset();
+    }
+
+    /// @brief Destroys the current value, then stores a value of type `T` constructed as if by
+    /// `T(std::forward<Args>(args)...)`.
+    /// @returns A reference to the constructed value.
+    /// @note Propagates exceptions thrown by `T`'s selected constructor, in which case the wrapper is empty.
+    template <typename T, typename... Args>
+    auto emplace(Args&&... args) noexcept(detail::nothrow_paren_constructible_from<T, Args...>) -> T&
+        requires(storable<T> and detail::paren_constructible_from<T, Args...>)
+    {
+        this->reset();
+        return this->construct<T>(std::forward<Args>(args)...);
+    }
+
+    /// @brief Destroys the value, if any, leaving the wrapper empty.
+    auto reset() noexcept {
+        if (not this->ops->trivial) {
+            this->ops->destroy(this->storage());
+        }
+        this->ops = std::addressof(empty_ops);
+    }
+
+    /// @brief Returns whether a value is stored.
+    [[nodiscard]]
+    auto has_value() const noexcept -> bool {
+        return this->ops != std::addressof(empty_ops);
+    }
+
+    /// @brief Returns whether the stored value is of type `T`.
+    template <typename T>
+    [[nodiscard]]
+    auto holds() const noexcept -> bool {
+        if constexpr (storable<std::remove_cv_t<T>>) {
+            return this->ops == std::addressof(ops_for<std::remove_cv_t<T>>);
+        } else {
+            return false;
+        }
+    }
+
+    /// @brief Returns a pointer to the value if it's of type `T`, or `nullptr` otherwise, preserving the constness of
+    /// @p self.
+    template <typename T, typename Self>
+    [[nodiscard]]
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    auto get_if(this Self&& self) noexcept -> auto* {
+        using value_type = std::conditional_t<detail::const_ref<Self>, T const, T>;
+        return self.template holds<T>() ? std::launder(static_cast<value_type*>(self.storage())) : nullptr;
+    }
+
+  private:
+    /// @brief Operations on the stored value, shared by every wrapper storing values of the same type.
+    struct ops_type {
+        /// @brief Copy constructs the value whose storage is the first argument into the storage that is the second
+        /// one.
+        void (*copy)(void const*, void*);
+
+        /// @brief Relocates the value whose storage is the first argument to the storage that is the second one.
+        void (*relocate)(void*, void*) noexcept;
+
+        /// @brief Destroys the value whose storage is the argument.
+        void (*destroy)(void*) noexcept;
+
+        /// @brief Whether the value is trivially copyable, in which case it's copied and moved by copying the buffer,
+        /// and not destroyed.
+        bool trivial;
+    };
+
+    /// @brief Operations of wrappers storing values of type `T`.
+    template <typename T>
+    static constexpr auto ops_for = ops_type{
+        .copy = [](void const* const src, void* const dst) {
+            ::new (dst) T(*std::launder(static_cast<T const*>(src)));
+        },
+        .relocate = [](void* const src, void* const dst) noexcept {
+            if constexpr (is_trivially_relocatable_v<T>) {
+                std::memcpy(dst, src, sizeof(T));
+            } else {
+                auto& value = *std::launder(static_cast<T*>(src));
+                ::new (dst) T(std::move(value));
+                value.~T();
+            }
+        },
+        .destroy = [](void* const storage) noexcept { std::launder(static_cast<T*>(storage))->~T(); },
+        .trivial = std::is_trivially_copyable_v<T>,
+    };
+
+    /// @brief Operations of empty wrappers, whose buffer can be copied like that of a trivially copyable value.
+    static constexpr auto empty_ops = ops_type{
+        .copy = nullptr,
+        .relocate = nullptr,
+        .destroy = nullptr,
+        .trivial = true,
+    };
+
+    /// @brief Returns a pointer to the buffer.
+    [[nodiscard]]
+    auto storage() const noexcept -> void* {
+        return static_cast<void*>(this->buffer.ptr());
+    }
+
+    /// @brief Copies the buffer of @p other, which holds a trivially copyable value or nothing.
+    auto copy_buffer(inplace_any const& other) noexcept {
+        std::memcpy(this->storage(), other.storage(), Size);
+    }
+
+    /// @brief Constructs a value of type `T` in the empty buffer, as if by `T(std::forward<Args>(args)...)`.
+    template <typename T, typename... Args>
+    auto construct(Args&&... args) noexcept(detail::nothrow_paren_constructible_from<T, Args...>) -> T& {
+        auto* const value = ::new (this->storage()) T(std::forward<Args>(args)...);
+        this->ops = std::addressof(ops_for<T>);
+        return *value;
+    }
+
+    /// @brief Relocates the value of @p other into the empty buffer, leaving @p other empty.
+    auto steal(inplace_any& other) noexcept {
+        if (other.ops->trivial) {
+            this->copy_buffer(other);
+        } else {
+            other.ops->relocate(other.storage(), this->storage());
+        }
+        this->ops = std::exchange(other.ops, std::addressof(empty_ops));
+    }
+
+    /// @brief Operations on the stored value.
+    ops_type const* ops = std::addressof(empty_ops);
+
+    /// @brief The buffer the value is constructed in. `mutable`, so that `storage()` can hand it to the copy and
+    /// relocation operations of `const` wrappers.
+    alignas(Align) mutable maybe_uninit<std::array<std::byte, Size>> buffer{};
+};
+
+/// @brief Returns a pointer to the value of @p any if it's of type `T`, or `nullptr` otherwise.
+/// @relatedalso inplace_any
+template <typename T, std::size_t Size, std::size_t Align>
+[[nodiscard]]
+auto any_cast(inplace_any<Size, Align>* const any) noexcept -> T* {
+    return any != nullptr ? any->template get_if<T>() : nullptr;
+}
+
+/// @brief Returns a pointer to the value of @p any if it's of type `T`, or `nullptr` otherwise.
+/// @relatedalso inplace_any
+template <typename T, std::size_t Size, std::size_t Align>
+[[nodiscard]]
+auto any_cast(inplace_any<Size, Align> const* const any) noexcept -> T const* {
+    return any != nullptr ? any->template get_if<T>() : nullptr;
+}
+
+/// @brief Returns the value of @p any, as if by `static_cast<T>(*any_cast<U>(&any))`, where `U` is `T` without
+/// reference and cv-qualifiers.
+/// @note Throws `std::bad_any_cast` if the value isn't of type `U`.
+/// @relatedalso inplace_any
+template <typename T, std::size_t Size, std::size_t Align>
+[[nodiscard]]
+auto any_cast(inplace_any<Size, Align> const& any) -> T
+    requires std::is_constructible_v<T, std::remove_cvref_t<T> const&>
+{
+    auto const* const value = any_cast<std::remove_cvref_t<T>>(std::addressof(any));
+    if (value == nullptr) {
+        throw std::bad_any_cast();
+    }
+    return static_cast<T>(*value);
+}
+
+/// @brief Returns the value of @p any, as if by `static_cast<T>(*any_cast<U>(&any))`, where `U` is `T` without
+/// reference and cv-qualifiers.
+/// @note Throws `std::bad_any_cast` if the value isn't of type `U`.
+/// @relatedalso inplace_any
+template <typename T, std::size_t Size, std::size_t Align>
+[[nodiscard]]
+auto any_cast(inplace_any<Size, Align>& any) -> T
+    requires std::is_constructible_v<T, std::remove_cvref_t<T>&>
+{
+    auto* const value = any_cast<std::remove_cvref_t<T>>(std::addressof(any));
+    if (value == nullptr) {
+        throw std::bad_any_cast();
+    }
+    return static_cast<T>(*value);
+}
+
+/// @brief Returns the value of @p any, as if by `static_cast<T>(std::move(*any_cast<U>(&any)))`, where `U` is `T`
+/// without reference and cv-qualifiers.
+/// @note Throws `std::bad_any_cast` if the value isn't of type `U`.
+/// @relatedalso inplace_any
+template <typename T, std::size_t Size, std::size_t Align>
+[[nodiscard]]
+auto any_cast(inplace_any<Size, Align>&& any) -> T
+    requires std::is_constructible_v<T, std::remove_cvref_t<T>>
+{
+    auto* const value = any_cast<std::remove_cvref_t<T>>(std::addressof(any));
+    if (value == nullptr) {
+        throw std::bad_any_cast();
+    }
+    return static_cast<T>(std::move(*value));
+}
+
+} // namespace MAYBE_UNINIT_NAMESPACE
@@ -0,0 +1,239 @@
+/// @file
+/// @brief Defines the template type `inplace_function`, a move-only polymorphic function wrapper which stores its
+/// callable in a fixed-size `maybe_uninit` buffer and never allocates.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+template <typename Sig, std::size_t Capacity = 4 * sizeof(void*), std::size_t Align = alignof(std::max_align_t)>
+class inplace_function;
+
+/// @brief Move-only polymorphic function wrapper, like `std::move_only_function`, whose callable is stored in a buffer
+/// of `Capacity` bytes inside the wrapper rather than on the heap.
+/// @details The callable is constructed in a `maybe_uninit` byte buffer, and is invoked, relocated and destroyed
+/// through a static table of function pointers, one per callable type, so calling an `inplace_function` costs a
+/// single indirect call. Callables which don't fit in the buffer, or whose alignment the buffer can't honor, are
+/// rejected at compile time instead of falling back to the heap:
+/// @code {.cpp}
+///     auto on_read = inplace_function<void(std::span<std::byte const>), 32>(
+///         [&session, id, deadline](std::span<std::byte const> data) { session.handle(id, deadline, data); }
+///     );
+///     loop.on_read(fd, std::move(on_read));
+/// @endcode
+/// Stored callables must be nothrow relocatable, so that moving an `inplace_function` can't throw. Trivially
+/// relocatable ones are moved with `memcpy`.
+/// @tparam R Return type of the call operator.
+/// @tparam Args Parameter types of the call operator.
+/// @tparam Capacity Size of the buffer, in bytes.
+/// @tparam Align Alignment of the buffer.
+/// @see `is_trivially_relocatable`
+template <typename R, typename... Args, std::size_t Capacity, std::size_t Align>
+    requires(Capacity != 0 and std::has_single_bit(Align))
+class inplace_function<R(Args...), Capacity, Align> {
+    /// @brief Matches callables which can be stored in the buffer.
+    template <typename F>
+    static constexpr bool storable = std::is_object_v<F> and std::is_invocable_r_v<R, F&, Args...>
+                                 and detail::fits_in<F, Capacity, Align> and detail::nothrow_relocatable<F>;
+
+  public:
+    using result_type = R;
+
+    /// @brief Default constructor. Constructs an empty wrapper.
+    inplace_function() noexcept = default;
+
+    /// @brief Constructs an empty wrapper.
+    inplace_function(std::nullptr_t) noexcept {} // NOLINT(google-explicit-constructor)
+
+    /// @brief Stores a callable move or copy constructed from @p f, or constructs an empty wrapper if @p f is a null
+    /// function pointer or member pointer.
+    /// @note Propagates exceptions thrown by the constructor of the callable, in which case the wrapper is empty.
+    template <typename F>
+    // NOLINTNEXTLINE(google-explicit-constructor)
+    inplace_function(F&& f) noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F>)
+        requires(not std::is_same_v<std::remove_cvref_t<F>, inplace_function> and storable<std::decay_t<F>>
+                 and std::is_constructible_v<std::decay_t<F>, F>)
+    {
+        if (not is_null(f)) {
+            this->construct<std::decay_t<F>>(std::forward<F>(f));
+        }
+    }
+
+    /// @brief Stores a callable of type `F` constructed as if by `F(std::forward<CArgs>(args)...)`.
+    /// @note Propagates exceptions thrown by `F`'s selected constructor, in which case the wrapper is empty.
+    template <typename F, typename... CArgs>
+    explicit inplace_function(std::in_place_type_t<F>, CArgs&&... args) noexcept(
+        detail::nothrow_paren_constructible_from<F, CArgs...>
+    )
+        requires(storable<F> and detail::paren_constructible_from<F, CArgs...>)
+    {
+        this->construct<F>(std::forward<CArgs>(args)...);
+    }
+
+    inplace_function(inplace_function const&) = delete;
+    auto operator=(inplace_function const&) -> inplace_function& = delete;
+
+    /// @brief Move constructor. Relocates the callable of @p other, leaving it empty.
+    inplace_function(inplace_function&& other) noexcept {
+        this->steal(other);
+    }
+
+    /// @brief Move assignment operator. Destroys the current callable, then relocates the callable of @p other,
+    /// leaving it empty.
+    auto operator=(inplace_function&& other) noexcept -> inplace_function& {
+        if (this != std::addressof(other)) {
+            this->reset();
+            this->steal(other);
+        }
+        return *this;
+    }
+
+    /// @brief Destroys the current callable, leaving the wrapper empty.
+    auto operator=(std::nullptr_t) noexcept -> inplace_function& {
+        this->reset();
+        return *this;
+    }
+
+    /// @brief Destroys the current callable, then stores a callable move or copy constructed from @p f, unless @p f
+    /// is a null function pointer or member pointer, which leaves the wrapper empty.
+    /// @note Propagates exceptions thrown by the constructor of the callable, in which case the wrapper is empty.
+    template <typename F>
+    auto operator=(F&& f) noexcept(std::is_nothrow_constructible_v<std::decay_t<F>, F>) -> inplace_function&
+        requires(not std::is_same_v<std::remove_cvref_t<F>, inplace_function> and storable<std::decay_t<F>>
+                 and std::is_constructible_v<std::decay_t<F>, F>)
+    {
+        this->reset();
+        if (not is_null(f)) {
+            this->construct<std::decay_t<F>>(std::forward<F>(f));
+        }
+        return *this;
+    }
+
+    /// @brief Destructor. Destroys the callable, if any.
+    ~inplace_function() {
+        this->reset();
+    }
+
+    /// @brief Returns whether a callable is stored.
+    [[nodiscard]]
+    explicit operator bool() const noexcept {
+        return this->vtable != std::addressof(empty_vtable);
+    }
+
+    /// @brief Invokes the callable with @p args.
+    /// @returns The result of the callable, converted to `R`.
+    /// @note Throws `std::bad_function_call` if no callable is stored.
+    auto operator()(Args... args) const -> R {
+        return this->vtable->invoke(this->storage(), std::forward<Args>(args)...);
+    }
+
+  private:
+    /// @brief Operations on the stored callable, shared by every wrapper storing callables of the same type.
+    struct vtable_type {
+        /// @brief Invokes the callable whose storage is the first argument with the remaining arguments.
+        R (*invoke)(void*, Args&&...);
+
+        /// @brief Relocates the callable whose storage is the first argument to the storage that is the second one.
+        void (*relocate)(void*, void*) noexcept;
+
+        /// @brief Destroys the callable whose storage is the argument.
+        void (*destroy)(void*) noexcept;
+    };
+
+    /// @brief Returns the callable of type `F` constructed in @p storage.
+    template <typename F>
+    static auto object(void* const storage) noexcept -> F& {
+        return *std::launder(static_cast<F*>(storage));
+    }
+
+    /// @brief Operations of wrappers storing callables of type `F`.
+    template <typename F>
+    static constexpr auto vtable_for = vtable_type{
+        .invoke = [](void* const storage, Args&&... args) -> R {
+            return std::invoke_r<R>(object<F>(storage), std::forward<Args>(args)...);
+        },
+        .relocate = [](void* const src, void* const dst) noexcept {
+            if constexpr (is_trivially_relocatable_v<F>) {
+                std::memcpy(dst, src, sizeof(F));
+            } else {
+                auto& callable = object<F>(src);
+                ::new (dst) F(std::move(callable));
+                callable.~F();
+            }
+        },
+        .destroy = [](void* const storage) noexcept { object<F>(storage).~F(); },
+    };
+
+    /// @brief Operations of empty wrappers, so that calls needn't check for emptiness.
+    static constexpr auto empty_vtable = vtable_type{
+        .invoke = [](void*, Args&&...) -> R { throw std::bad_function_call(); },
+        .relocate = [](void*, void*) noexcept {},
+        .destroy = [](void*) noexcept {},
+    };
+
+    /// @brief Returns whether @p f is a null function pointer or member pointer, which is stored as an empty wrapper,
+    /// like `std::function` does, rather than as a callable which would jump to null.
+    template <typename F>
+    [[nodiscard]]
+    static auto is_null(F const& f) noexcept -> bool {
+        if constexpr (std::is_pointer_v<F> or std::is_member_pointer_v<F>) {
+            return f == nullptr;
+        } else {
+            return false;
+        }
+    }
+
+    /// @brief Returns a pointer to the buffer.
+    [[nodiscard]]
+    auto storage() const noexcept -> void* {
+        return static_cast<void*>(this->buffer.ptr());
+    }
+
+    /// @brief Constructs a callable of type `F` in the empty buffer, as if by `F(std::forward<CArgs>(args)...)`.
+    template <typename F, typename... CArgs>
+    auto construct(CArgs&&... args) noexcept(detail::nothrow_paren_constructible_from<F, CArgs...>) {
+        ::new (this->storage()) F(std::forward<CArgs>(args)...);
+        this->vtable = std::addressof(vtable_for<F>);
+    }
+
+    /// @brief Relocates the callable of @p other into the empty buffer, leaving @p other empty.
+    auto steal(inplace_function& other) noexcept {
+        other.vtable->relocate(other.storage(), this->storage());
+        this->vtable = std::exchange(other.vtable, std::addressof(empty_vtable));
+    }
+
+    /// @brief Destroys the callable, if any, leaving the wrapper empty.
+    auto reset() noexcept {
+        this->vtable->destroy(this->storage());
+        this->vtable = std::addressof(empty_vtable);
+    }
+
+    /// @brief Operations on the stored callable.
+    vtable_type const* vtable = std::addressof(empty_vtable);
+
+    /// @brief The buffer the callable is constructed in. `mutable`, as the call operator is `const` but invokes the
+    /// callable as non-`const`, like `std::function`.
+    alignas(Align) mutable maybe_uninit<std::array<std::byte, Capacity>> buffer{};
+};
+
+/// @brief Returns whether @p f is empty.
+/// @relatedalso inplace_function
+template <typename Sig, std::size_t Capacity, std::size_t Align>
+[[nodiscard]]
+auto operator==(inplace_function<Sig, Capacity, Align> const& f, std::nullptr_t) noexcept -> bool {
+    return not f;
+}
+
+} // namespace MAYBE_UNINIT_NAMESPACE
@@ -0,0 +1,359 @@
+/// @file
+/// @brief Defines the template type `inplace_vector`, a fixed-capacity vector whose storage is an array of
+/// `maybe_uninit` slots.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+/// @brief Vector with a fixed capacity of @p N elements, stored inline.
+/// @details `inplace_vector` never allocates dynamic memory. Its storage is an array of `maybe_uninit<T>` slots, of
+/// which only the first `size()` hold constructed objects. When `T` is trivially copyable/destructible, so is
+/// `inplace_vector`:
+/// @code {.cpp}
+///     auto ints = inplace_vector<int, 16>{}; // no int is constructed.
+///     ints.push_back(1);
+///     ints.emplace_back(2);
+///     ints.insert(ints.begin(), 0); // 0, 1, 2
+///     ints.erase(ints.begin() + 1); // 0, 2
+/// @endcode
+/// @tparam T Type of the elements.
+/// @tparam N Maximum number of elements.
+/// @attention Inserting into a full `inplace_vector` is undefined behavior. Use `try_emplace_back()` when the vector
+/// may be full.
+template <detail::sized T, std::size_t N>
+    requires(N > 0)
+class inplace_vector {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = T const&;
+    using pointer = T*;
+    using const_pointer = T const*;
+    using iterator = T*;
+    using const_iterator = T const*;
+
+    /// @brief Default constructor. Constructs an empty vector, performing no initialization on the slots.
+    constexpr inplace_vector() noexcept = default;
+
+    /// @brief Copy constructor for trivially copy constructible `T`s.
+    constexpr inplace_vector(inplace_vector const&)
+        requires std::copy_constructible<T> and std::is_trivially_copy_constructible_v<T>
+    = default;
+
+    /// @brief Copy constructor. Copy constructs the first `other.size()` elements.
+    /// @note Propagates exceptions thrown by `T`'s copy constructor, after destroying the elements copied so far.
+    constexpr inplace_vector(inplace_vector const& other) noexcept(std::is_nothrow_copy_constructible_v<T>)
+        requires std::copy_constructible<T>
+    {
+        this->construct_from(other.begin(), other.end());
+    }
+
+    /// @brief Move constructor for trivially move constructible `T`s.
+    constexpr inplace_vector(inplace_vector&&)
+        requires std::move_constructible<T> and std::is_trivially_move_constructible_v<T>
+    = default;
+
+    /// @brief Move constructor. Move constructs the first `other.size()` elements.
+    /// @note @p other keeps its size, and its elements are left in a moved-from state.
+    /// @note Propagates exceptions thrown by `T`'s move constructor, after destroying the elements moved so far.
+    constexpr inplace_vector(inplace_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        requires std::move_constructible<T>
+    {
+        this->construct_from(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+    }
+
+    /// @brief Copy assignment operator for trivially copyable `T`s.
+    constexpr auto operator=(inplace_vector const&) -> inplace_vector&
+        requires std::copyable<T> and std::is_trivially_copyable_v<T>
+    = default;
+
+    /// @brief Copy assignment operator. Copy assigns the common prefix, then constructs or destroys the remainder.
+    constexpr auto operator=(inplace_vector const& other) noexcept(
+        std::is_nothrow_copy_constructible_v<T> and std::is_nothrow_copy_assignable_v<T>
+    ) -> inplace_vector&
+        requires std::copyable<T>
+    {
+        if (this != std::addressof(other)) {
+            this->assign_from(other.begin(), other.end());
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment operator for trivially copyable `T`s.
+    constexpr auto operator=(inplace_vector&&) -> inplace_vector&
+        requires std::movable<T> and std::is_trivially_copyable_v<T>
+    = default;
+
+    /// @brief Move assignment operator. Move assigns the common prefix, then constructs or destroys the remainder.
+    /// @note @p other keeps its size, and its elements are left in a moved-from state.
+    constexpr auto operator=(inplace_vector&& other) noexcept(
+        std::is_nothrow_move_constructible_v<T> and std::is_nothrow_move_assignable_v<T>
+    ) -> inplace_vector&
+        requires std::movable<T>
+    {
+        if (this != std::addressof(other)) {
+            this->assign_from(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        }
+        return *this;
+    }
+
+    /// @brief Destructor for trivially destructible `T`s. Destruction is redundant for these types, so defaulting it
+    /// trivializes `inplace_vector` in these cases.
+    constexpr ~inplace_vector()
+        requires std::is_trivially_destructible_v<T>
+    = default;
+
+    /// @brief Destructor for non-trivial `T`s. Destroys every element.
+    constexpr ~inplace_vector() {
+        this->clear();
+    }
+
+    /// @brief Returns the number of elements.
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return this->count;
+    }
+
+    /// @brief Returns the maximum number of elements, i.e. @p N.
+    [[nodiscard]]
+    static constexpr auto capacity() noexcept -> size_type {
+        return N;
+    }
+
+    /// @brief Returns whether the vector holds no elements.
+    [[nodiscard]]
+    constexpr auto empty() const noexcept -> bool {
+        return this->count == 0;
+    }
+
+    /// @brief Returns whether the vector holds @p N elements.
+    [[nodiscard]]
+    constexpr auto full() const noexcept -> bool {
+        return this->count == N;
+    }
+
+    /// @brief Returns a pointer to the storage of the first element, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    // rvalue-ref to lvalue-ref decay is intentional, to allow taking the address of self.slots when self is an rvalue
+    // reference.
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto data(this Self&& self) noexcept -> auto* {
+        return self.slots.front().ptr();
+    }
+
+    /// @brief Returns an iterator to the first element, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto begin(this Self&& self) noexcept -> auto* {
+        return std::forward<Self>(self).data();
+    }
+
+    /// @brief Returns an iterator past the last element, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto end(this Self&& self) noexcept -> auto* {
+        return std::forward<Self>(self).data() + self.count;
+    }
+
+    /// @brief Returns a reference to the element at @p index, preserving the constness of @p self.
+    /// @pre `index < size()`.
+    template <typename Self>
+    [[nodiscard]]
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto operator[](this Self&& self, size_type const index) noexcept -> auto& {
+        return self.slots[index].ref();
+    }
+
+    /// @brief Returns a reference to the first element, preserving the constness of @p self.
+    /// @pre `not empty()`.
+    template <typename Self>
+    [[nodiscard]]
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto front(this Self&& self) noexcept -> auto& {
+        return self.slots.front().ref();
+    }
+
+    /// @brief Returns a reference to the last element, preserving the constness of @p self.
+    /// @pre `not empty()`.
+    template <typename Self>
+    [[nodiscard]]
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto back(this Self&& self) noexcept -> auto& {
+        return self.slots[self.count - 1].ref();
+    }
+
+    /// @brief Returns a span over the elements, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto span(this Self&& self) noexcept -> std::ranges::borrowed_range auto {
+        return std::span(std::forward<Self>(self).data(), self.count);
+    }
+
+    /// @brief Constructs an element at the end as if by `T(std::forward<Args>(args)...)`.
+    /// @returns A reference to the constructed element.
+    /// @pre `not full()`.
+    /// @note Propagates exceptions thrown by `T`'s selected constructor, in which case the vector is left unchanged.
+    template <typename... Args>
+    constexpr auto emplace_back(Args&&... args) noexcept(detail::nothrow_paren_constructible_from<T, Args...>) -> T&
+        requires detail::paren_constructible_from<T, Args...>
+    {
+        auto& object = this->slots[this->count].paren_init(std::forward<Args>(args)...);
+        ++this->count;
+        return object;
+    }
+
+    /// @brief Constructs an element at the end as if by `T(std::forward<Args>(args)...)`, if there's room for it.
+    /// @returns A pointer to the constructed element, or `nullptr` if the vector is full.
+    /// @note Propagates exceptions thrown by `T`'s selected constructor, in which case the vector is left unchanged.
+    template <typename... Args>
+    constexpr auto try_emplace_back(Args&&... args) noexcept(detail::nothrow_paren_constructible_from<T, Args...>)
+        -> T*
+        requires detail::paren_constructible_from<T, Args...>
+    {
+        if (this->full()) {
+            return nullptr;
+        }
+        return std::addressof(this->emplace_back(std::forward<Args>(args)...));
+    }
+
+    /// @brief Copy constructs @p value at the end.
+    /// @pre `not full()`.
+    constexpr auto push_back(T const& value) noexcept(std::is_nothrow_copy_constructible_v<T>) -> T&
+        requires std::is_copy_constructible_v<T>
+    {
+        return this->emplace_back(value);
+    }
+
+    /// @brief Move constructs @p value at the end.
+    /// @pre `not full()`.
+    constexpr auto push_back(T&& value) noexcept(std::is_nothrow_move_constructible_v<T>) -> T&
+        requires std::is_move_constructible_v<T>
+    {
+        return this->emplace_back(std::move(value));
+    }
+
+    /// @brief Destroys the last element.
+    /// @pre `not empty()`.
+    constexpr auto pop_back() noexcept(std::is_nothrow_destructible_v<T>) {
+        --this->count;
+        this->slots[this->count].destroy();
+    }
+
+    /// @brief Constructs an element before @p pos as if by `T(std::forward<Args>(args)...)`.
+    /// @details The element is constructed at the end and then rotated into place.
+    /// @returns An iterator to the constructed element.
+    /// @pre `not full()`.
+    template <typename... Args>
+    constexpr auto emplace(const_iterator const pos, Args&&... args) -> iterator
+        requires detail::paren_constructible_from<T, Args...> and std::is_move_constructible_v<T>
+                 and std::is_move_assignable_v<T>
+    {
+        auto const offset = pos - this->begin();
+        this->emplace_back(std::forward<Args>(args)...);
+        auto const first = this->begin() + offset;
+        std::rotate(first, this->end() - 1, this->end());
+        return first;
+    }
+
+    /// @brief Copy constructs @p value before @p pos.
+    /// @pre `not full()`.
+    constexpr auto insert(const_iterator const pos, T const& value) -> iterator
+        requires std::is_copy_constructible_v<T>
+    {
+        return this->emplace(pos, value);
+    }
+
+    /// @brief Move constructs @p value before @p pos.
+    /// @pre `not full()`.
+    constexpr auto insert(const_iterator const pos, T&& value) -> iterator
+        requires std::is_move_constructible_v<T>
+    {
+        return this->emplace(pos, std::move(value));
+    }
+
+    /// @brief Erases the elements in `[first, last)`, shifting the following elements left.
+    /// @returns An iterator to the element following the last erased one.
+    constexpr auto erase(const_iterator const first, const_iterator const last) -> iterator
+        requires std::is_move_assignable_v<T>
+    {
+        auto const begin = this->begin() + (first - this->begin());
+        auto const new_end = std::move(begin + (last - first), this->end(), begin);
+        this->destroy_from(static_cast<size_type>(new_end - this->begin()));
+        return begin;
+    }
+
+    /// @brief Erases the element at @p pos, shifting the following elements left.
+    /// @returns An iterator to the element following the erased one.
+    /// @pre @p pos is dereferenceable.
+    constexpr auto erase(const_iterator const pos) -> iterator
+        requires std::is_move_assignable_v<T>
+    {
+        return this->erase(pos, pos + 1);
+    }
+
+    /// @brief Destroys every element.
+    constexpr auto clear() noexcept(std::is_nothrow_destructible_v<T>) {
+        this->destroy_from(0);
+    }
+
+  private:
+    /// @brief Constructs the elements from `[first, last)`, assuming the vector is empty.
+    /// @note Propagates exceptions thrown by `T`'s selected constructor, after destroying the constructed elements.
+    template <typename It>
+    constexpr auto construct_from(It first, It const last) {
+        try {
+            for (; first != last; ++first) {
+                this->emplace_back(*first);
+            }
+        } catch (...) {
+            this->clear();
+            throw;
+        }
+    }
+
+    /// @brief Assigns the elements from `[first, last)` over the current ones, constructing or destroying the
+    /// difference.
+    template <typename It>
+    constexpr auto assign_from(It first, It const last) {
+        auto const other_count = static_cast<size_type>(last - first);
+        auto const common = std::min(this->count, other_count);
+        first = std::ranges::copy_n(first, static_cast<difference_type>(common), this->begin()).in;
+        for (; first != last; ++first) {
+            this->emplace_back(*first);
+        }
+        this->destroy_from(other_count);
+    }
+
+    /// @brief Destroys the elements starting at @p new_count, in reverse order.
+    constexpr auto destroy_from(size_type const new_count) noexcept(std::is_nothrow_destructible_v<T>) {
+        if constexpr (std::is_trivially_destructible_v<T>) {
+            this->count = std::min(this->count, new_count);
+        } else {
+            while (this->count > new_count) {
+                this->pop_back();
+            }
+        }
+    }
+
+    /// @brief The element slots, of which the first `count` are constructed.
+    std::array<maybe_uninit<T>, N> slots{};
+
+    /// @brief Number of constructed elements.
+    size_type count = 0;
+};
+
+} // namespace MAYBE_UNINIT_NAMESPACE
@@ -0,0 +1,316 @@
+/// @file
+/// @brief Defines the template types `once_cell` and `lazy`, lazily initialized `maybe_uninit` objects, along with
+/// their single-threaded counterparts `unsync_once_cell` and `unsync_lazy`.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <atomic>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+/// @brief Object which is initialized at most once, by the first thread to call `get_or_init()`, replacing
+/// function-local statics.
+/// @details Once initialized, `get_or_init()` costs a single acquire load, which is a plain load on x86 and ARMv8, and
+/// no guard function is called. Threads calling `get_or_init()` while another one is initializing wait for it via
+/// `std::atomic::wait`. The default constructor is `constexpr`, so cells can be `constinit` globals, which are
+/// constructed at compile time instead of during startup:
+/// @code {.cpp}
+///     constinit auto config = once_cell<Config>{};
+///
+///     auto get_config() -> Config const& {
+///         return config.get_or_init([] { return Config::load("app.toml"); });
+///     }
+/// @endcode
+/// @tparam T Type of the value.
+template <detail::sized T>
+class once_cell {
+  public:
+    /// @brief Default constructor. Constructs an empty cell, performing no initialization on the object.
+    constexpr once_cell() noexcept = default;
+
+    once_cell(once_cell const&) = delete;
+    once_cell(once_cell&&) = delete;
+    auto operator=(once_cell const&) -> once_cell& = delete;
+    auto operator=(once_cell&&) -> once_cell& = delete;
+
+    /// @brief Destructor. Destroys the object, if initialized.
+    ~once_cell() {
+        this->reset();
+    }
+
+    /// @brief Returns the object, initializing it as if by `T(std::invoke(std::forward<F>(f)))` if no thread did so
+    /// before. The result of @p f is constructed in place, so `T` needn't be movable.
+    /// @details If another thread is initializing the object, waits for it to finish.
+    /// @returns A reference to the object.
+    /// @pre @p f doesn't call `get_or_init()` on the same cell.
+    /// @note Propagates exceptions thrown by @p f and by `T`'s selected constructor, in which case the cell stays
+    /// empty, and the next call, possibly from a waiting thread, tries again.
+    template <typename F>
+    auto get_or_init(F&& f) noexcept(detail::nothrow_invoke_constructible_from<T, F>) -> T&
+        requires detail::invoke_constructible_from<T, F>
+    {
+        if (this->state.load(std::memory_order_acquire) != state_type::ready) [[unlikely]] {
+            this->init(std::forward<F>(f));
+        }
+        return *std::launder(this->storage.ptr());
+    }
+
+    /// @brief Returns a pointer to the object, or `nullptr` if it isn't initialized yet, preserving the constness of
+    /// @p self.
+    template <typename Self>
+    [[nodiscard]]
+    auto get(this Self&& self) noexcept -> auto* {
+        return self.state.load(std::memory_order_acquire) == state_type::ready
+                 ? std::launder(std::forward<Self>(self).storage.ptr())
+                 : nullptr;
+    }
+
+    /// @brief Destroys the object, if initialized, leaving the cell empty, e.g. to isolate tests from one another.
+    /// @pre No other thread is accessing the cell.
+    auto reset() noexcept(std::is_nothrow_destructible_v<T>) {
+        if (this->state.load(std::memory_order_relaxed) == state_type::ready) {
+            this->storage.destroy();
+            this->state.store(state_type::empty, std::memory_order_relaxed);
+        }
+    }
+
+  private:
+    /// @brief Initialization state of the cell.
+    enum class state_type : unsigned char {
+        empty,
+        initializing,
+        ready,
+    };
+
+    /// @brief Slow path of `get_or_init()`. Initializes the object if no thread is initializing it, or waits for the
+    /// thread that is.
+    template <typename F>
+    [[gnu::noinline]]
+    auto init(F&& f) noexcept(detail::nothrow_invoke_constructible_from<T, F>) {
+        auto current = this->state.load(std::memory_order_acquire);
+        while (current != state_type::ready) {
+            if (current == state_type::initializing) {
+                this->state.wait(current, std::memory_order_acquire);
+                current = this->state.load(std::memory_order_acquire);
+            } else if (this->state.compare_exchange_weak(
+                           current,
+                           state_type::initializing,
+                           std::memory_order_acquire
+                       )) {
+                this->construct(std::forward<F>(f));
+                this->state.store(state_type::ready, std::memory_order_release);
+                this->state.notify_all();
+                return;
+            }
+        }
+    }
+
+    /// @brief Constructs the object from the result of @p f. If an exception is thrown, empties the cell and wakes up
+    /// waiting threads, so that one of them tries again.
+    template <typename F>
+    auto construct(F&& f) noexcept(detail::nothrow_invoke_constructible_from<T, F>) {
+        if constexpr (detail::nothrow_invoke_constructible_from<T, F>) {
+            this->storage.init_with(std::forward<F>(f));
+        } else {
+            try {
+                this->storage.init_with(std::forward<F>(f));
+            } catch (...) {
+                this->state.store(state_type::empty, std::memory_order_relaxed);
+                this->state.notify_all();
+                throw;
+            }
+        }
+    }
+
+    /// @brief The object, constructed while `state` is `ready`.
+    maybe_uninit<T> storage{};
+
+    /// @brief Initialization state of the cell.
+    std::atomic<state_type> state = state_type::empty;
+};
+
+/// @brief Single-threaded `once_cell`, whose fast path is a plain `bool` check.
+/// @tparam T Type of the value.
+/// @attention The cell mustn't be accessed by multiple threads at a time.
+template <detail::sized T>
+class unsync_once_cell {
+  public:
+    /// @brief Default constructor. Constructs an empty cell, performing no initialization on the object.
+    constexpr unsync_once_cell() noexcept = default;
+
+    unsync_once_cell(unsync_once_cell const&) = delete;
+    unsync_once_cell(unsync_once_cell&&) = delete;
+    auto operator=(unsync_once_cell const&) -> unsync_once_cell& = delete;
+    auto operator=(unsync_once_cell&&) -> unsync_once_cell& = delete;
+
+    /// @brief Destructor. Destroys the object, if initialized.
+    constexpr ~unsync_once_cell() {
+        this->reset();
+    }
+
+    /// @brief Returns the object, initializing it as if by `T(std::invoke(std::forward<F>(f)))` if it isn't yet. The
+    /// result of @p f is constructed in place, so `T` needn't be movable.
+    /// @returns A reference to the object.
+    /// @pre @p f doesn't call `get_or_init()` on the same cell.
+    /// @note Propagates exceptions thrown by @p f and by `T`'s selected constructor, in which case the cell stays
+    /// empty.
+    template <typename F>
+    constexpr auto get_or_init(F&& f) noexcept(detail::nothrow_invoke_constructible_from<T, F>) -> T&
+        requires detail::invoke_constructible_from<T, F>
+    {
+        if (not this->initialized) [[unlikely]] {
+            this->storage.init_with(std::forward<F>(f));
+            this->initialized = true;
+        }
+        return *std::launder(this->storage.ptr());
+    }
+
+    /// @brief Returns a pointer to the object, or `nullptr` if it isn't initialized yet, preserving the constness of
+    /// @p self.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto get(this Self&& self) noexcept -> auto* {
+        return self.initialized ? std::launder(std::forward<Self>(self).storage.ptr()) : nullptr;
+    }
+
+    /// @brief Destroys the object, if initialized, leaving the cell empty.
+    constexpr auto reset() noexcept(std::is_nothrow_destructible_v<T>) {
+        if (this->initialized) {
+            this->storage.destroy();
+            this->initialized = false;
+        }
+    }
+
+  private:
+    /// @brief The object, constructed while `initialized` is `true`.
+    maybe_uninit<T> storage{};
+
+    /// @brief Whether the object is constructed.
+    bool initialized = false;
+};
+
+/// @brief `once_cell` which knows how to initialize itself, i.e. a thread-safe lazily initialized object.
+/// @details The object is initialized from the result of the initializer upon first access. The constructor is
+/// `constexpr`, so lazies of function pointers or captureless lambdas can be `constinit` globals:
+/// @code {.cpp}
+///     constinit auto registry = lazy<Registry>(+[] { return Registry::scan(plugin_dir); });
+///
+///     registry->find("png"); // scans on first access.
+/// @endcode
+/// @tparam T Type of the value.
+/// @tparam F Type of the initializer, invoked without arguments.
+template <detail::sized T, typename F = T (*)()>
+    requires detail::invoke_constructible_from<T, F&>
+class lazy {
+  public:
+    /// @brief Constructs an uninitialized lazy which initializes its object from the result of @p init.
+    explicit constexpr lazy(F init) noexcept(std::is_nothrow_move_constructible_v<F>)
+        : init(std::move(init)) {}
+
+    /// @brief Returns the object, initializing it if no thread did so before.
+    /// @note Propagates exceptions thrown by the initializer and by `T`'s selected constructor.
+    [[nodiscard]]
+    auto get() noexcept(detail::nothrow_invoke_constructible_from<T, F&>) -> T& {
+        return this->cell.get_or_init(this->init);
+    }
+
+    /// @brief Returns the object, initializing it if no thread did so before.
+    [[nodiscard]]
+    auto operator*() noexcept(detail::nothrow_invoke_constructible_from<T, F&>) -> T& {
+        return this->get();
+    }
+
+    /// @brief Returns a pointer to the object, initializing it if no thread did so before.
+    [[nodiscard]]
+    auto operator->() noexcept(detail::nothrow_invoke_constructible_from<T, F&>) -> T* {
+        return std::addressof(this->get());
+    }
+
+    /// @brief Returns whether the object is initialized.
+    [[nodiscard]]
+    auto is_initialized() const noexcept -> bool {
+        return this->cell.get() != nullptr;
+    }
+
+    /// @brief Destroys the object, if initialized, so that the next access initializes it again.
+    /// @pre No other thread is accessing the lazy.
+    auto reset() noexcept(std::is_nothrow_destructible_v<T>) {
+        this->cell.reset();
+    }
+
+  private:
+    /// @brief The lazily initialized object.
+    once_cell<T> cell;
+
+    /// @brief The initializer.
+    F init;
+};
+
+/// @brief Deduction guide that allows deducing the object type of a `lazy` from the result of its initializer.
+/// @relatedalso lazy
+template <typename F>
+lazy(F) -> lazy<std::remove_cvref_t<std::invoke_result_t<F&>>, F>;
+
+/// @brief Single-threaded `lazy`, built on `unsync_once_cell`.
+/// @tparam T Type of the value.
+/// @tparam F Type of the initializer, invoked without arguments.
+/// @attention The lazy mustn't be accessed by multiple threads at a time.
+template <detail::sized T, typename F = T (*)()>
+    requires detail::invoke_constructible_from<T, F&>
+class unsync_lazy {
+  public:
+    /// @brief Constructs an uninitialized lazy which initializes its object from the result of @p init.
+    explicit constexpr unsync_lazy(F init) noexcept(std::is_nothrow_move_constructible_v<F>)
+        : init(std::move(init)) {}
+
+    /// @brief Returns the object, initializing it if it isn't yet.
+    /// @note Propagates exceptions thrown by the initializer and by `T`'s selected constructor.
+    [[nodiscard]]
+    constexpr auto get() noexcept(detail::nothrow_invoke_constructible_from<T, F&>) -> T& {
+        return this->cell.get_or_init(this->init);
+    }
+
+    /// @brief Returns the object, initializing it if it isn't yet.
+    [[nodiscard]]
+    constexpr auto operator*() noexcept(detail::nothrow_invoke_constructible_from<T, F&>) -> T& {
+        return this->get();
+    }
+
+    /// @brief Returns a pointer to the object, initializing it if it isn't yet.
+    [[nodiscard]]
+    constexpr auto operator->() noexcept(detail::nothrow_invoke_constructible_from<T, F&>) -> T* {
+        return std::addressof(this->get());
+    }
+
+    /// @brief Returns whether the object is initialized.
+    [[nodiscard]]
+    constexpr auto is_initialized() const noexcept -> bool {
+        return this->cell.get() != nullptr;
+    }
+
+    /// @brief Destroys the object, if initialized, so that the next access initializes it again.
+    constexpr auto reset() noexcept(std::is_nothrow_destructible_v<T>) {
+        this->cell.reset();
+    }
+
+  private:
+    /// @brief The lazily initialized object.
+    unsync_once_cell<T> cell;
+
+    /// @brief The initializer.
+    F init;
+};
+
+/// @brief Deduction guide that allows deducing the object type of an `unsync_lazy` from the result of its
+/// initializer.
+/// @relatedalso unsync_lazy
+template <typename F>
+unsync_lazy(F) -> unsync_lazy<std::remove_cvref_t<std::invoke_result_t<F&>>, F>;
+
+} // namespace MAYBE_UNINIT_NAMESPACE
@@ -4,11 +4,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <bit>
 #include <cstddef>
+#include <cstring>
+#include <functional>
 #include <memory>
 #include <new>    // IWYU pragma: keep, false positive (need ::new).
 #include <ranges> // IWYU pragma: keep, false positive (std::ranges::borrowed_range).
 #include <span>
+#include <thread>
 #include <type_traits>
 #include <utility>
 
@@ -17,6 +22,60 @@
 #   define MAYBE_UNINIT_NAMESPACE mem
 #endif
 
+/// @brief Size, in bytes, assumed for cache lines when separating data to prevent false sharing. Defaults to `64`, but
+/// can be overriden.
+/// @note `std::hardware_destructive_interference_size` isn't used by default, as its value may vary between compiler
+/// flags, which would make the layout of types using it part of an unstable ABI.
+#ifndef MAYBE_UNINIT_CACHE_LINE_SIZE
+#   define MAYBE_UNINIT_CACHE_LINE_SIZE 64
+#endif
+
+/// @brief Whether `checked_maybe_uninit` tracks the lifetime of its object. Defaults to `1` unless `NDEBUG` is defined,
+/// but can be overriden.
+#ifndef MAYBE_UNINIT_CHECKED
+#   ifdef NDEBUG
+#      define MAYBE_UNINIT_CHECKED 0
+#   else
+#      define MAYBE_UNINIT_CHECKED 1
+#   endif
+#endif
+
+#if MAYBE_UNINIT_CHECKED
+#   include <cstdio>
+#   include <cstdlib>
+
+/// @brief Invoked with a string literal describing the misuse when a `checked_maybe_uninit` check fails. Defaults to
+/// printing the message to `stderr` and aborting, but can be overriden.
+#   ifndef MAYBE_UNINIT_CHECK_FAILED
+#      define MAYBE_UNINIT_CHECK_FAILED(message) (std::fputs("maybe_uninit: " message "\n", stderr), std::abort())
+#   endif
+#endif
+
+// Storage of unconstructed objects is annotated as dead when building with AddressSanitizer or MemorySanitizer, or when
+// MAYBE_UNINIT_VALGRIND is defined.
+#if defined(__SANITIZE_ADDRESS__)
+#   define MAYBE_UNINIT_ASAN 1
+#elif defined(__has_feature)
+#   if __has_feature(address_sanitizer)
+#      define MAYBE_UNINIT_ASAN 1
+#   endif
+#endif
+#if defined(__has_feature)
+#   if __has_feature(memory_sanitizer)
+#      define MAYBE_UNINIT_MSAN 1
+#   endif
+#endif
+
+#ifdef MAYBE_UNINIT_ASAN
+#   include <sanitizer/asan_interface.h>
+#endif
+#ifdef MAYBE_UNINIT_MSAN
+#   include <sanitizer/msan_interface.h>
+#endif
+#ifdef MAYBE_UNINIT_VALGRIND
+#   include <valgrind/memcheck.h>
+#endif
+
 namespace MAYBE_UNINIT_NAMESPACE {
 
 namespace detail {
@@ -57,6 +116,19 @@ concept nothrow_brace_constructible_from = requires(T* p, Args&&... args) {
     { ::new (static_cast<void*>(p)) T{std::forward<Args>(args)...} } noexcept;
 };
 
+/// @brief Matches `T`s constructible from the result of `std::invoke(f, args...)`, without checking whether `T` is
+/// destructible. When the result is a `T` prvalue, no move occurs, thanks to guaranteed copy elision.
+template <typename T, typename F, typename... Args>
+concept invoke_constructible_from = requires(T* p, F&& f, Args&&... args) {
+    ::new (static_cast<void*>(p)) T(std::invoke(std::forward<F>(f), std::forward<Args>(args)...));
+};
+
+/// @brief `invoke_constructible_from` and also noexcept.
+template <typename T, typename F, typename... Args>
+concept nothrow_invoke_constructible_from = requires(T* p, F&& f, Args&&... args) {
+    { ::new (static_cast<void*>(p)) T(std::invoke(std::forward<F>(f), std::forward<Args>(args)...)) } noexcept;
+};
+
 /// @brief Matches a non-reference, non-void, non-function type whose size is known.
 template <typename T>
 concept sized = std::is_object_v<T> and requires { sizeof(T); };
@@ -65,6 +137,94 @@ concept sized = std::is_object_v<T> and requires { sizeof(T); };
 template <typename T>
 concept const_ref = std::is_reference_v<T> and std::is_const_v<std::remove_reference_t<T>>;
 
+/// @brief Matches [implicit-lifetime](https://en.cppreference.com/w/cpp/named_req/ImplicitLifetimeType) types, whose
+/// objects can be created by merely providing storage with a suitable object representation. Approximated from the
+/// definition if `std::is_implicit_lifetime` isn't available.
+template <typename T>
+concept implicit_lifetime =
+#if defined(__cpp_lib_is_implicit_lifetime)
+    std::is_implicit_lifetime_v<T>;
+#else
+    std::is_scalar_v<T> or std::is_array_v<T>
+    or (std::is_trivially_destructible_v<T>
+        and (std::is_aggregate_v<T> or std::is_trivially_default_constructible_v<T>
+             or std::is_trivially_copy_constructible_v<T> or std::is_trivially_move_constructible_v<T>));
+#endif
+
+/// @brief Implicitly creates an array of @p n `T`s in the storage starting at @p p, whose object representation is
+/// the bytes already there, and returns a pointer to its first element. Uses `std::start_lifetime_as_array` if
+/// available, or else `std::memmove` onto itself, which is specified to implicitly create objects in its destination
+/// and compiles to nothing.
+template <implicit_lifetime T>
+auto start_lifetime_as_array(void* const p, std::size_t const n) noexcept -> T* {
+#if defined(__cpp_lib_start_lifetime_as)
+    return std::start_lifetime_as_array<T>(p, n);
+#else
+    return std::launder(static_cast<T*>(std::memmove(p, p, n * sizeof(T))));
+#endif
+}
+
+/// @brief Alignment separating data accessed by different threads, so that they don't share a cache line.
+inline constexpr std::size_t cache_line_size = MAYBE_UNINIT_CACHE_LINE_SIZE;
+
+/// @brief Whether AddressSanitizer may poison the storage of unconstructed `T`s. Only types with non-trivial
+/// destructors are poisoned, as `maybe_uninit` can then unpoison them in its destructor, and can't be copied, so any
+/// access to dead storage is a bug. Trivial types are legitimately copied along with unconstructed neighbours, e.g. by
+/// the defaulted copy constructors of containers.
+template <typename T>
+inline constexpr bool asan_poisonable = not std::is_trivially_destructible_v<T>;
+
+/// @brief Annotates the storage of the @p n objects starting at @p p as dead for the enabled sanitizers. Does nothing
+/// during constant evaluation, or if no sanitizer is enabled.
+template <typename T>
+constexpr auto poison(T const* const p, std::size_t const n = 1) noexcept {
+#if defined(MAYBE_UNINIT_ASAN) or defined(MAYBE_UNINIT_MSAN) or defined(MAYBE_UNINIT_VALGRIND)
+    if !consteval {
+#   ifdef MAYBE_UNINIT_ASAN
+        if constexpr (asan_poisonable<T>) {
+            __asan_poison_memory_region(p, n * sizeof(T));
+        }
+#   endif
+#   ifdef MAYBE_UNINIT_MSAN
+        __msan_allocated_memory(p, n * sizeof(T));
+#   endif
+#   ifdef MAYBE_UNINIT_VALGRIND
+        if constexpr (asan_poisonable<T>) {
+            VALGRIND_MAKE_MEM_NOACCESS(p, n * sizeof(T));
+        } else {
+            VALGRIND_MAKE_MEM_UNDEFINED(p, n * sizeof(T));
+        }
+#   endif
+    }
+#else
+    static_cast<void>(p);
+    static_cast<void>(n);
+#endif
+}
+
+/// @brief Annotates the storage of the @p n objects starting at @p p as addressable, but undefined, for the enabled
+/// sanitizers. Does nothing during constant evaluation, or if no sanitizer is enabled.
+template <typename T>
+constexpr auto unpoison(T const* const p, std::size_t const n = 1) noexcept {
+#if defined(MAYBE_UNINIT_ASAN) or defined(MAYBE_UNINIT_VALGRIND)
+    if !consteval {
+#   ifdef MAYBE_UNINIT_ASAN
+        if constexpr (asan_poisonable<T>) {
+            __asan_unpoison_memory_region(p, n * sizeof(T));
+        }
+#   endif
+#   ifdef MAYBE_UNINIT_VALGRIND
+        if constexpr (asan_poisonable<T>) {
+            VALGRIND_MAKE_MEM_UNDEFINED(p, n * sizeof(T));
+        }
+#   endif
+    }
+#else
+    static_cast<void>(p);
+    static_cast<void>(n);
+#endif
+}
+
 } // namespace detail
 
 /// @brief Tag type used disambiguate the `maybe_uninit` constructor performing default initialization.
@@ -77,6 +237,47 @@ struct paren_init_t {};
 /// @brief Tag type used disambiguate the `maybe_uninit` constructor performing brace initialization, i.e. `T{args...}`.
 struct brace_init_t {};
 
+/// @brief Tag type used disambiguate the `maybe_uninit` constructor initializing from the result of an invocation, i.e.
+/// `T(std::invoke(f, args...))`.
+struct init_with_t {};
+
+/// @brief Trait telling whether objects of type `T` can be relocated, i.e. moved to another address and have their
+/// lifetime ended at the previous one, by copying their object representation with `memcpy`.
+/// @details Defaults to [std::is_trivially_copyable](https://en.cppreference.com/w/cpp/types/is_trivially_copyable).
+/// Most types that don't store pointers into themselves, such as smart pointers or heap-allocated strings, are also
+/// trivially relocatable, and can opt in by specializing this trait in the library's namespace:
+/// @code {.cpp}
+///     template <>
+///     struct mem::is_trivially_relocatable<Handle> : std::true_type {};
+/// @endcode
+/// @attention Opting in a type which isn't trivially relocatable, such as one storing a pointer to one of its members,
+/// is undefined behavior.
+template <typename T>
+struct is_trivially_relocatable : std::bool_constant<std::is_trivially_copyable_v<T>> {};
+
+/// @brief Helper variable template for `is_trivially_relocatable`.
+template <typename T>
+inline constexpr bool is_trivially_relocatable_v = is_trivially_relocatable<std::remove_cv_t<T>>::value;
+
+namespace detail {
+
+/// @brief Matches `T`s which can be relocated, either because they're trivially relocatable or by move construction
+/// followed by destruction.
+template <typename T>
+concept relocatable = paren_constructible_from<T, T> and std::is_destructible_v<T>;
+
+/// @brief `relocatable` and also noexcept.
+template <typename T>
+concept nothrow_relocatable
+    = relocatable<T>
+  and (is_trivially_relocatable_v<T> or (nothrow_paren_constructible_from<T, T> and std::is_nothrow_destructible_v<T>));
+
+/// @brief Matches `T`s whose objects fit in a buffer of `Size` bytes aligned to `Align` bytes.
+template <typename T, std::size_t Size, std::size_t Align>
+concept fits_in = sizeof(T) <= Size and Align % alignof(T) == 0;
+
+} // namespace detail
+
 /// @brief Constexpr wrapper of uninitialized values.
 /// @details `maybe_uninit` is useful when object construction should be deferred and default construction is either not
 /// possible, semantically invalid, or expensive. For example, given the following type:
@@ -118,7 +319,10 @@ template <detail::sized T>
 union maybe_uninit {
   public:
     /// @brief Default constructor. Performs no initialization on the object.
-    constexpr maybe_uninit() noexcept {}
+    /// @note Under sanitizers, the storage is annotated as dead until the object is constructed.
+    constexpr maybe_uninit() noexcept {
+        detail::poison(std::addressof(this->object));
+    }
 
     /// @brief Default initializes the object via `default_init()`.
     /// @param[in] default_init_t Disambiguation tag.
@@ -159,6 +363,24 @@ union maybe_uninit {
         this->brace_init(std::forward<Args>(args)...);
     }
 
+    /// @brief Initializes the object via `init_with()`.
+    /// @tparam F Type of the invocable whose result to initialize the object with.
+    /// @tparam ...Args Types of the arguments to invoke @p f with.
+    /// @param[in] init_with_t Disambiguation tag.
+    /// @param f Invocable whose result to initialize the object with.
+    /// @param args Arguments to invoke @p f with.
+    /// @see `init_with()`
+    template <typename F, typename... Args>
+    explicit constexpr maybe_uninit(
+        init_with_t,
+        F&& f,
+        Args&&... args
+    ) noexcept(detail::nothrow_invoke_constructible_from<T, F, Args...>)
+        requires detail::invoke_constructible_from<T, F, Args...>
+    {
+        this->init_with(std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
     /// @brief Destructor for trivial `T`s. Destruction is redundant for these types, so defaulting it trivializes
     /// `maybe_uninit` in these cases.
     constexpr ~maybe_uninit()
@@ -168,7 +390,9 @@ union maybe_uninit {
     /// @brief Destructor for non-trivial `T`s. Performs no destruction.
     /// @attention It's up to the caller to ensure the object's destructor is invoked if the object was constructed in
     /// the first place.
-    constexpr ~maybe_uninit() {}
+    constexpr ~maybe_uninit() {
+        detail::unpoison(std::addressof(this->object));
+    }
 
     /// @brief Default initializes the object.
     /// @returns A reference to the constructed object.
@@ -182,6 +406,7 @@ union maybe_uninit {
     constexpr auto default_init(this Self&& self) noexcept(detail::nothrow_default_constructible<T>) -> T&
         requires detail::default_constructible<T>
     {
+        detail::unpoison(std::addressof(self.object));
         return *::new (static_cast<void*>(std::addressof(self.object))) T;
     }
 
@@ -200,6 +425,7 @@ union maybe_uninit {
     paren_init(this Self&& self, Args&&... args) noexcept(detail::nothrow_paren_constructible_from<T, Args...>) -> T&
         requires detail::paren_constructible_from<T, Args...>
     {
+        detail::unpoison(std::addressof(self.object));
         return *::new (static_cast<void*>(std::addressof(self.object))) T(std::forward<Args>(args)...);
     }
 
@@ -218,13 +444,45 @@ union maybe_uninit {
     brace_init(this Self&& self, Args&&... args) noexcept(detail::nothrow_brace_constructible_from<T, Args...>) -> T&
         requires detail::brace_constructible_from<T, Args...>
     {
+        detail::unpoison(std::addressof(self.object));
         return *::new (static_cast<void*>(std::addressof(self.object))) T{std::forward<Args>(args)...};
     }
 
+    /// @brief Initializes the object as if by `T(std::invoke(std::forward<F>(f), std::forward<Args>(args)...))`.
+    /// @details When the invocation returns a `T` prvalue, the object is the result itself, by guaranteed copy elision.
+    /// No move occurs, so this can construct `T`s which are neither copyable nor movable from factory functions:
+    /// @code {.cpp}
+    ///     auto state = maybe_uninit<OperationState>(); // neither copyable nor movable.
+    ///     state.init_with(connect, sender, receiver);   // constructed directly by connect()'s return statement.
+    /// @endcode
+    /// @tparam F Type of the invocable whose result to initialize the object with.
+    /// @tparam ...Args Types of the arguments to invoke @p f with.
+    /// @param f Invocable whose result to initialize the object with.
+    /// @param args Arguments to invoke @p f with.
+    /// @returns A reference to the constructed object.
+    /// @note Propagates exceptions thrown by @p f and by `T`'s selected constructor.
+    template <typename Self, typename F, typename... Args>
+    constexpr auto
+    // rvalue-ref to lvalue-ref decay is intentional, to allow taking the address of self.object when self is an rvalue
+    // reference.
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    init_with(this Self&& self, F&& f, Args&&... args) noexcept(
+        detail::nothrow_invoke_constructible_from<T, F, Args...>
+    ) -> T&
+        requires detail::invoke_constructible_from<T, F, Args...>
+    {
+        detail::unpoison(std::addressof(self.object));
+        return *::new (static_cast<void*>(std::addressof(self.object)))
+            T(std::invoke(std::forward<F>(f), std::forward<Args>(args)...));
+    }
+
     /// @brief Returns a pointer to the possibly uninitialized object, preserving the constness of
     /// @p self.
     /// @attention It's up to the caller to ensure accesses to the object through this pointer do not occur beyond the
     /// object's lifetime.
+    /// @note Under sanitizers, the annotations of the storage are left as they are, so that accesses through this
+    /// pointer after `destroy()` are reported. To construct the object manually through it, call `assume_init()`
+    /// first, which annotates the storage as addressable.
     template <typename Self>
     [[nodiscard]]
     // rvalue-ref to lvalue-ref decay is intentional, to allow taking the address of self.object when self is an rvalue
@@ -247,6 +505,8 @@ union maybe_uninit {
     /// `T`.
     /// @attention It's up to the caller to ensure accesses to the object representation through this span do not occur
     /// beyond the object's lifetime.
+    /// @note Under sanitizers, the storage is annotated as addressable, so that the object representation can be
+    /// manually written through this span.
     template <typename Self>
     [[nodiscard]]
     // rvalue-ref to lvalue-ref decay is intentional, to allow taking the address of self.object when self is an rvalue
@@ -254,6 +514,7 @@ union maybe_uninit {
     // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
     constexpr auto bytes(this Self&& self) noexcept -> std::ranges::borrowed_range auto {
         using byte_type = std::conditional_t<detail::const_ref<Self> or std::is_const_v<T>, std::byte const, std::byte>;
+        detail::unpoison(std::addressof(self.object));
         return std::span<byte_type, sizeof(T)>(
             // Required to access object representation of self.object.
             // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
@@ -264,6 +525,7 @@ union maybe_uninit {
 
     /// @brief Destroys the possibly uninitialized object by invoking its destructor.
     /// @attention The object is assumed to be constructed when this function is invoked.
+    /// @note Under sanitizers, the storage is annotated as dead until the object is constructed again.
     template <typename Self>
     // rvalue-ref to lvalue-ref decay is intentional, to allow taking the address of self.object when self is an rvalue
     // reference.
@@ -272,6 +534,79 @@ union maybe_uninit {
         if constexpr (not std::is_trivially_destructible_v<T>) {
             std::destroy_at(std::addressof(self.object));
         }
+        detail::poison(std::addressof(self.object));
+    }
+
+    /// @brief Relocates the object into @p dst, ending its lifetime in @p self.
+    /// @details For trivially relocatable `T`s, this is a single `memcpy` of `bytes()`. Otherwise, the object is move
+    /// constructed into @p dst and then destroyed.
+    /// @returns A reference to the relocated object.
+    /// @attention The object is assumed to be constructed, and @p dst is assumed not to be, when this function is
+    /// invoked.
+    /// @see `is_trivially_relocatable`
+    template <typename Self>
+    // rvalue-ref to lvalue-ref decay is intentional, to allow taking the address of self.object when self is an rvalue
+    // reference.
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto relocate_into(this Self&& self, maybe_uninit& dst) noexcept(detail::nothrow_relocatable<T>) -> T&
+        requires detail::relocatable<T>
+    {
+        if constexpr (is_trivially_relocatable_v<T>) {
+            if !consteval {
+                std::memcpy(dst.bytes().data(), self.bytes().data(), sizeof(T));
+                detail::poison(std::addressof(self.object));
+                return *std::launder(dst.ptr());
+            }
+        }
+        auto& object = dst.paren_init(std::move(self.object));
+        self.destroy();
+        return object;
+    }
+
+    /// @brief Relocates the object of @p src into @p self, ending its lifetime in @p src.
+    /// @returns A reference to the relocated object.
+    /// @attention The object of @p src is assumed to be constructed, and the object of @p self is assumed not to be,
+    /// when this function is invoked.
+    /// @see `relocate_into()`
+    template <typename Self>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto relocate_from(this Self&& self, maybe_uninit& src) noexcept(detail::nothrow_relocatable<T>) -> T&
+        requires detail::relocatable<T>
+    {
+        return src.relocate_into(self);
+    }
+
+    /// @brief Starts the lifetime of an object whose object representation is the current content of `bytes()`, e.g.
+    /// after reading a fixed-layout record from a file or socket into them, without copying it.
+    /// @details Uses `std::start_lifetime_as` if available, and a self-`memmove`, which implicitly creates objects and
+    /// is optimized away, otherwise:
+    /// @code {.cpp}
+    ///     auto record = maybe_uninit<Record>{};
+    ///     socket.receive(record.bytes());
+    ///     Record& r = record.assume_init_from_bytes();
+    /// @endcode
+    /// @returns A reference to the object.
+    /// @pre The bytes are a valid object representation of `T`.
+    /// @attention The object is assumed not to be constructed when this function is invoked.
+    auto assume_init_from_bytes() noexcept -> T&
+        requires detail::implicit_lifetime<T>
+    {
+        detail::unpoison(std::addressof(this->object));
+        return *detail::start_lifetime_as_array<T>(std::addressof(this->object), 1);
+    }
+
+    /// @brief Informs that the object is about to be constructed manually, e.g. through `ptr()`. Under sanitizers, the
+    /// storage is annotated as addressable, so call it before constructing the object. Also informs
+    /// `checked_maybe_uninit` of the construction.
+    constexpr auto assume_init() noexcept {
+        detail::unpoison(std::addressof(this->object));
+    }
+
+    /// @brief Informs that the object was destroyed manually, e.g. through `ref()`. Under sanitizers, the storage is
+    /// annotated as dead until the object is constructed again. Also informs `checked_maybe_uninit` of the
+    /// destruction.
+    constexpr auto assume_uninit() noexcept {
+        detail::poison(std::addressof(this->object));
     }
 
   private:
@@ -353,4 +688,707 @@ constexpr auto brace_init(T&& t) noexcept(detail::nothrow_brace_constructible_fr
     return maybe_uninit<std::remove_reference_t<T>>{brace_init_t{}, std::forward<T>(t)};
 }
 
+namespace detail {
+
+/// @brief Object type of the `maybe_uninit` returned by `init_with()`: `T`, unless it's `void`, in which case the
+/// result type of invoking `F` with `Args`, without cv-qualifiers and references.
+template <typename T, typename F, typename... Args>
+using init_with_value_t
+    = std::conditional_t<std::is_void_v<T>, std::remove_cvref_t<std::invoke_result_t<F, Args...>>, T>;
+
+} // namespace detail
+
+/// @brief Shorthand for `maybe_uninit<T>(init_with_t{}, std::forward<F>(f), std::forward<Args>(args)...)`.
+/// @details `T` may be omitted, in which case it's deduced from the result of the invocation, e.g. for
+/// operation states whose types are unwieldy to spell:
+/// @code {.cpp}
+///     auto state = init_with(connect, std::move(sender), receiver);
+/// @endcode
+/// @relatedalso maybe_uninit
+template <typename T = void, typename F, typename... Args>
+constexpr auto init_with(F&& f, Args&&... args) noexcept(
+    detail::nothrow_invoke_constructible_from<detail::init_with_value_t<T, F, Args...>, F, Args...>
+) -> maybe_uninit<detail::init_with_value_t<T, F, Args...>>
+    requires detail::sized<detail::init_with_value_t<T, F, Args...>>
+         and detail::invoke_constructible_from<detail::init_with_value_t<T, F, Args...>, F, Args...>
+{
+    return maybe_uninit<detail::init_with_value_t<T, F, Args...>>{
+        init_with_t{},
+        std::forward<F>(f),
+        std::forward<Args>(args)...
+    };
+}
+
+namespace detail {
+
+/// @brief Maps `maybe_uninit<T>` to `T`. Undefined for any other type.
+template <typename Slot>
+struct slot_value {};
+
+/// @brief Maps `maybe_uninit<T>` to `T`.
+template <typename T>
+struct slot_value<maybe_uninit<T>> {
+    using type = T;
+};
+
+/// @brief Underlying object type of the `maybe_uninit` elements of the range @p R.
+template <typename R>
+using slot_value_t = typename slot_value<std::ranges::range_value_t<R>>::type;
+
+/// @brief Matches contiguous, sized and borrowed ranges of mutable `maybe_uninit` slots, such as
+/// `std::array<maybe_uninit<T>, N>&` or `std::span<maybe_uninit<T>>`.
+template <typename R>
+concept slot_range = std::ranges::contiguous_range<R> and std::ranges::sized_range<R>
+                 and std::ranges::borrowed_range<R> and requires { typename slot_value_t<R>; }
+                 and not std::is_const_v<std::remove_reference_t<std::ranges::range_reference_t<R>>>;
+
+/// @brief Matches types whose value-initialized state is all zero bytes, i.e. arithmetic, enumeration and object
+/// pointer types.
+template <typename T>
+concept zero_initializable = std::is_arithmetic_v<T> or std::is_enum_v<T> or std::is_pointer_v<T>;
+
+/// @brief Returns a span over the @p n objects stored in the slots starting at @p first.
+template <typename T>
+constexpr auto as_objects(maybe_uninit<T>* const first, std::size_t const n) noexcept -> std::span<T> {
+    if (n == 0) {
+        return {};
+    }
+    return std::span<T>(first->ptr(), n);
+}
+
+/// @brief Destroys the objects stored in the @p n slots starting at @p first, in reverse order.
+template <typename T>
+constexpr auto destroy_n_reverse(maybe_uninit<T>* const first, std::size_t n) noexcept(
+    std::is_nothrow_destructible_v<T>
+) {
+    if constexpr (not std::is_trivially_destructible_v<T>) {
+        while (n != 0) {
+            first[--n].destroy();
+        }
+    }
+}
+
+/// @brief Invokes @p init on each of the @p n slots starting at @p first, in order.
+/// @note Propagates exceptions thrown by @p init, after destroying the objects constructed so far.
+template <typename T, typename Init>
+constexpr auto init_n_or_rollback(maybe_uninit<T>* const first, std::size_t const n, Init init) {
+    auto i = std::size_t{0};
+    try {
+        for (; i != n; ++i) {
+            init(first[i]);
+        }
+    } catch (...) {
+        detail::destroy_n_reverse(first, i);
+        throw;
+    }
+}
+
+} // namespace detail
+
+/// @brief Initializes every slot of @p slots as if by `T(args...)`.
+/// @details For zero-initializable types, such as integers, floating point numbers and pointers, value-initialization
+/// lowers to a single `memset`, as does initialization of single-byte types. Other trivial types are initialized by a
+/// plain loop of stores, which compilers vectorize.
+/// @param slots Uninitialized slots, such as a `std::array<maybe_uninit<T>, N>` or a `std::span<maybe_uninit<T>>`.
+/// @param args Arguments to pass to the constructor of every object. They're never moved from.
+/// @returns A span over the constructed objects.
+/// @note Propagates exceptions thrown by `T`'s selected constructor, after destroying the objects constructed so far.
+/// @relatedalso maybe_uninit
+template <detail::slot_range R, typename... Args>
+constexpr auto init_all(R&& slots, Args const&... args) noexcept(
+    detail::nothrow_paren_constructible_from<detail::slot_value_t<R>, Args const&...>
+) -> std::span<detail::slot_value_t<R>>
+    requires detail::paren_constructible_from<detail::slot_value_t<R>, Args const&...>
+{
+    using T = detail::slot_value_t<R>;
+    auto* const first = std::ranges::data(slots);
+    auto const n = std::ranges::size(slots);
+    if constexpr (sizeof...(Args) == 0 and detail::zero_initializable<T>) {
+        if !consteval {
+            if (n != 0) {
+                std::memset(static_cast<void*>(first), 0, n * sizeof(T));
+            }
+            return detail::as_objects(first, n);
+        }
+    } else if constexpr (sizeof(T) == 1 and std::is_trivially_copyable_v<T> and sizeof...(Args) != 0) {
+        if !consteval {
+            if (n != 0) {
+                std::memset(static_cast<void*>(first), std::bit_cast<unsigned char>(T(args...)), n);
+            }
+            return detail::as_objects(first, n);
+        }
+    }
+    detail::init_n_or_rollback(first, n, [&](maybe_uninit<T>& slot) { slot.paren_init(args...); });
+    return detail::as_objects(first, n);
+}
+
+/// @brief Initializes the leading slots of @p slots from the elements of @p source, as if by `T(element)`.
+/// @details Stops at the end of the shorter range. Copying a contiguous range of trivially copyable `T`s lowers to a
+/// single `memcpy`.
+/// @param slots Uninitialized slots, such as a `std::array<maybe_uninit<T>, N>` or a `std::span<maybe_uninit<T>>`.
+/// @param source Range whose elements are forwarded to the constructor of each object.
+/// @returns A span over the constructed objects.
+/// @note Propagates exceptions thrown by `T`'s selected constructor, after destroying the objects constructed so far.
+/// @relatedalso maybe_uninit
+template <detail::slot_range R, std::ranges::input_range Source>
+    requires std::ranges::sized_range<Source>
+constexpr auto init_from_range(R&& slots, Source&& source) noexcept(
+    detail::nothrow_paren_constructible_from<detail::slot_value_t<R>, std::ranges::range_reference_t<Source>>
+) -> std::span<detail::slot_value_t<R>>
+    requires detail::paren_constructible_from<detail::slot_value_t<R>, std::ranges::range_reference_t<Source>>
+{
+    using T = detail::slot_value_t<R>;
+    auto* const first = std::ranges::data(slots);
+    auto const n = std::min(std::ranges::size(slots), static_cast<std::size_t>(std::ranges::size(source)));
+    if constexpr (std::ranges::contiguous_range<Source>
+                  and std::is_same_v<std::remove_cv_t<std::ranges::range_value_t<Source>>, T>
+                  and std::is_trivially_copyable_v<T>) {
+        if !consteval {
+            if (n != 0) {
+                std::memcpy(static_cast<void*>(first), std::ranges::data(source), n * sizeof(T));
+            }
+            return detail::as_objects(first, n);
+        }
+    }
+    auto it = std::ranges::begin(source);
+    detail::init_n_or_rollback(first, n, [&](maybe_uninit<T>& slot) { slot.paren_init(*it++); });
+    return detail::as_objects(first, n);
+}
+
+/// @brief Initializes the first @p n slots of @p slots with the results of successive invocations of @p gen.
+/// @details Each object is constructed directly from the result of `std::invoke(gen)`, so no intermediate move occurs
+/// when @p gen returns a `T` prvalue.
+/// @param slots Uninitialized slots, such as a `std::array<maybe_uninit<T>, N>` or a `std::span<maybe_uninit<T>>`.
+/// @param n Number of slots to initialize.
+/// @param gen Generator invoked once per object.
+/// @returns A span over the constructed objects.
+/// @pre `n <= std::ranges::size(slots)`.
+/// @note Propagates exceptions thrown by @p gen or by `T`'s selected constructor, after destroying the objects
+/// constructed so far.
+/// @relatedalso maybe_uninit
+template <detail::slot_range R, typename Gen>
+constexpr auto init_n_with(R&& slots, std::size_t const n, Gen&& gen) noexcept(
+    detail::nothrow_invoke_constructible_from<detail::slot_value_t<R>, Gen&>
+) -> std::span<detail::slot_value_t<R>>
+    requires detail::invoke_constructible_from<detail::slot_value_t<R>, Gen&>
+{
+    using T = detail::slot_value_t<R>;
+    auto* const first = std::ranges::data(slots);
+    detail::init_n_or_rollback(first, n, [&](maybe_uninit<T>& slot) { slot.init_with(gen); });
+    return detail::as_objects(first, n);
+}
+
+/// @brief Starts the lifetime of the objects whose object representations are the current content of the bytes of
+/// every slot of @p slots, without copying them.
+/// @details The span counterpart of `maybe_uninit::assume_init_from_bytes()`, e.g. to hand out a typed view over a
+/// receive buffer of records:
+/// @code {.cpp}
+///     auto records = uninit_buffer<Record>(64);
+///     auto const n = socket.receive(std::as_writable_bytes(records.slots())) / sizeof(Record);
+///     std::span<Record> received = assume_init_from_bytes(records.slots().first(n));
+/// @endcode
+/// @param slots Slots whose bytes were written to, such as a `std::array<maybe_uninit<T>, N>` or a
+/// `std::span<maybe_uninit<T>>`.
+/// @returns A span over the objects.
+/// @pre The bytes of every slot are a valid object representation of `T`.
+/// @attention The objects are assumed not to be constructed when this function is invoked.
+/// @relatedalso maybe_uninit
+template <detail::slot_range R>
+auto assume_init_from_bytes(R&& slots) noexcept -> std::span<detail::slot_value_t<R>>
+    requires detail::implicit_lifetime<detail::slot_value_t<R>>
+{
+    using T = detail::slot_value_t<R>;
+    auto* const first = std::ranges::data(slots);
+    auto const n = std::ranges::size(slots);
+    if (n != 0) {
+        detail::unpoison(first->ptr(), n);
+        detail::start_lifetime_as_array<T>(first, n);
+    }
+    return detail::as_objects(first, n);
+}
+
+/// @brief Destroys the objects stored in every slot of @p slots, in order.
+/// @details Compiles down to nothing for trivially destructible types.
+/// @param slots Initialized slots, such as a `std::array<maybe_uninit<T>, N>` or a `std::span<maybe_uninit<T>>`.
+/// @attention Every object is assumed to be constructed when this function is invoked.
+/// @relatedalso maybe_uninit
+template <detail::slot_range R>
+constexpr auto destroy_all(R&& slots) noexcept(std::is_nothrow_destructible_v<detail::slot_value_t<R>>) {
+    if constexpr (not std::is_trivially_destructible_v<detail::slot_value_t<R>>) {
+        for (auto& slot : slots) {
+            slot.destroy();
+        }
+    }
+}
+
+/// @brief Relocates the objects of every slot of @p source into the leading slots of @p destination, ending their
+/// lifetime in @p source.
+/// @details For trivially relocatable `T`s, this is a single `memcpy`. Otherwise, objects are relocated one by one if
+/// their move constructor can't throw. If it can, every object is first move constructed, and the originals are only
+/// destroyed once all of them have been.
+/// @param source Initialized slots.
+/// @param destination Uninitialized slots.
+/// @returns A span over the relocated objects.
+/// @pre `std::ranges::size(destination) >= std::ranges::size(source)`, and the ranges don't overlap.
+/// @note Propagates exceptions thrown by `T`'s move constructor, after destroying the objects moved so far. The
+/// objects of @p source are then left constructed.
+/// @relatedalso maybe_uninit
+/// @see `is_trivially_relocatable`
+template <detail::slot_range Source, detail::slot_range Destination>
+constexpr auto relocate_all(Source&& source, Destination&& destination) noexcept(
+    detail::nothrow_relocatable<detail::slot_value_t<Source>>
+) -> std::span<detail::slot_value_t<Source>>
+    requires std::is_same_v<detail::slot_value_t<Source>, detail::slot_value_t<Destination>>
+             and detail::relocatable<detail::slot_value_t<Source>>
+{
+    using T = detail::slot_value_t<Source>;
+    auto* const from = std::ranges::data(source);
+    auto* const to = std::ranges::data(destination);
+    auto const n = std::ranges::size(source);
+    if constexpr (is_trivially_relocatable_v<T>) {
+        if !consteval {
+            if (n != 0) {
+                detail::unpoison(to->ptr(), n);
+                std::memcpy(static_cast<void*>(to), static_cast<void const*>(from), n * sizeof(T));
+                detail::poison(from->ptr(), n);
+            }
+            return detail::as_objects(to, n);
+        }
+    }
+    if constexpr (detail::nothrow_relocatable<T>) {
+        for (auto i = std::size_t{0}; i != n; ++i) {
+            from[i].relocate_into(to[i]);
+        }
+    } else {
+        auto it = from;
+        detail::init_n_or_rollback(to, n, [&](maybe_uninit<T>& slot) { slot.paren_init(std::move(it++->ref())); });
+        destroy_all(source);
+    }
+    return detail::as_objects(to, n);
+}
+
+#if MAYBE_UNINIT_CHECKED
+
+/// @brief `maybe_uninit` which tracks whether its object is constructed, and fails via `MAYBE_UNINIT_CHECK_FAILED`
+/// when it's accessed or destroyed while unconstructed, or constructed again before being destroyed.
+/// @details Checks are enabled by `MAYBE_UNINIT_CHECKED`. When disabled, `checked_maybe_uninit<T>` is an alias of
+/// `maybe_uninit<T>`, with the exact same layout and codegen.
+/// @details `ptr()` and `bytes()` aren't checked, as they're used to access the storage before the object is
+/// constructed. If the object is constructed or destroyed through them, inform the checker via `assume_init()` and
+/// `assume_uninit()`, which then only update sanitizer annotations when checks are disabled.
+/// @tparam T Type of the value.
+/// @pre `T` is a complete [object](https://en.cppreference.com/w/cpp/types/is_object) type.
+template <detail::sized T>
+class checked_maybe_uninit {
+  public:
+    /// @brief Default constructor. Performs no initialization on the object.
+    constexpr checked_maybe_uninit() noexcept = default;
+
+    /// @brief Default initializes the object via `default_init()`.
+    /// @param[in] default_init_t Disambiguation tag.
+    explicit constexpr checked_maybe_uninit(default_init_t) noexcept(detail::nothrow_default_constructible<T>)
+        requires detail::default_constructible<T>
+    {
+        this->default_init();
+    }
+
+    /// @brief Initializes the object via `paren_init()`.
+    /// @param[in] paren_init_t Disambiguation tag.
+    /// @param args Arguments to forward to the constructor of the object.
+    template <typename... Args>
+    explicit constexpr checked_maybe_uninit(
+        paren_init_t,
+        Args&&... args
+    ) noexcept(detail::nothrow_paren_constructible_from<T, Args...>)
+        requires detail::paren_constructible_from<T, Args...>
+    {
+        this->paren_init(std::forward<Args>(args)...);
+    }
+
+    /// @brief Initializes the object via `brace_init()`.
+    /// @param[in] brace_init_t Disambiguation tag.
+    /// @param args Arguments to forward to the constructor of the object.
+    template <typename... Args>
+    explicit constexpr checked_maybe_uninit(
+        brace_init_t,
+        Args&&... args
+    ) noexcept(detail::nothrow_brace_constructible_from<T, Args...>)
+        requires detail::brace_constructible_from<T, Args...>
+    {
+        this->brace_init(std::forward<Args>(args)...);
+    }
+
+    /// @brief Initializes the object via `init_with()`.
+    /// @param[in] init_with_t Disambiguation tag.
+    /// @param f Invocable whose result to initialize the object with.
+    /// @param args Arguments to invoke @p f with.
+    template <typename F, typename... Args>
+    explicit constexpr checked_maybe_uninit(
+        init_with_t,
+        F&& f,
+        Args&&... args
+    ) noexcept(detail::nothrow_invoke_constructible_from<T, F, Args...>)
+        requires detail::invoke_constructible_from<T, F, Args...>
+    {
+        this->init_with(std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    /// @brief Checked `maybe_uninit::default_init()`.
+    /// @pre The object isn't constructed.
+    template <typename Self>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto default_init(this Self&& self) noexcept(detail::nothrow_default_constructible<T>) -> T&
+        requires detail::default_constructible<T>
+    {
+        self.check_uninit();
+        auto& object = self.storage.default_init();
+        self.initialized = true;
+        return object;
+    }
+
+    /// @brief Checked `maybe_uninit::paren_init()`.
+    /// @pre The object isn't constructed.
+    template <typename Self, typename... Args>
+    constexpr auto
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    paren_init(this Self&& self, Args&&... args) noexcept(detail::nothrow_paren_constructible_from<T, Args...>) -> T&
+        requires detail::paren_constructible_from<T, Args...>
+    {
+        self.check_uninit();
+        auto& object = self.storage.paren_init(std::forward<Args>(args)...);
+        self.initialized = true;
+        return object;
+    }
+
+    /// @brief Checked `maybe_uninit::brace_init()`.
+    /// @pre The object isn't constructed.
+    template <typename Self, typename... Args>
+    constexpr auto
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    brace_init(this Self&& self, Args&&... args) noexcept(detail::nothrow_brace_constructible_from<T, Args...>) -> T&
+        requires detail::brace_constructible_from<T, Args...>
+    {
+        self.check_uninit();
+        auto& object = self.storage.brace_init(std::forward<Args>(args)...);
+        self.initialized = true;
+        return object;
+    }
+
+    /// @brief Checked `maybe_uninit::init_with()`.
+    /// @pre The object isn't constructed.
+    template <typename Self, typename F, typename... Args>
+    constexpr auto
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    init_with(this Self&& self, F&& f, Args&&... args) noexcept(
+        detail::nothrow_invoke_constructible_from<T, F, Args...>
+    ) -> T&
+        requires detail::invoke_constructible_from<T, F, Args...>
+    {
+        self.check_uninit();
+        auto& object = self.storage.init_with(std::forward<F>(f), std::forward<Args>(args)...);
+        self.initialized = true;
+        return object;
+    }
+
+    /// @brief Unchecked `maybe_uninit::ptr()`.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto ptr(this Self&& self) noexcept -> auto* {
+        return std::forward<Self>(self).storage.ptr();
+    }
+
+    /// @brief Checked `maybe_uninit::ref()`.
+    /// @pre The object is constructed.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto ref(this Self&& self) noexcept -> auto&& {
+        self.check_init();
+        return std::forward<Self>(self).storage.ref();
+    }
+
+    /// @brief Unchecked `maybe_uninit::bytes()`.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto bytes(this Self&& self) noexcept -> std::ranges::borrowed_range auto {
+        return std::forward<Self>(self).storage.bytes();
+    }
+
+    /// @brief Checked `maybe_uninit::destroy()`.
+    /// @pre The object is constructed.
+    template <typename Self>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto destroy(this Self&& self) noexcept(std::is_nothrow_destructible_v<T>) {
+        self.check_init();
+        self.storage.destroy();
+        self.initialized = false;
+    }
+
+    /// @brief Checked `maybe_uninit::relocate_into()`.
+    /// @pre The object is constructed, and the object of @p dst isn't.
+    template <typename Self>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto relocate_into(this Self&& self, checked_maybe_uninit& dst) noexcept(detail::nothrow_relocatable<T>)
+        -> T&
+        requires detail::relocatable<T>
+    {
+        self.check_init();
+        dst.check_uninit();
+        auto& object = self.storage.relocate_into(dst.storage);
+        self.initialized = false;
+        dst.initialized = true;
+        return object;
+    }
+
+    /// @brief Checked `maybe_uninit::relocate_from()`.
+    /// @pre The object of @p src is constructed, and the object isn't.
+    template <typename Self>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto relocate_from(this Self&& self, checked_maybe_uninit& src) noexcept(detail::nothrow_relocatable<T>)
+        -> T&
+        requires detail::relocatable<T>
+    {
+        return src.relocate_into(self);
+    }
+
+    /// @brief Checked `maybe_uninit::assume_init_from_bytes()`.
+    /// @pre The object isn't constructed.
+    auto assume_init_from_bytes() noexcept -> T&
+        requires detail::implicit_lifetime<T>
+    {
+        this->check_uninit();
+        auto& object = this->storage.assume_init_from_bytes();
+        this->initialized = true;
+        return object;
+    }
+
+    /// @brief Informs the checker that the object is constructed through `ptr()` or `bytes()`. See
+    /// `maybe_uninit::assume_init()`.
+    constexpr auto assume_init() noexcept {
+        this->storage.assume_init();
+        this->initialized = true;
+    }
+
+    /// @brief Informs the checker that the object was destroyed through `ptr()` or `ref()`. See
+    /// `maybe_uninit::assume_uninit()`.
+    constexpr auto assume_uninit() noexcept {
+        this->storage.assume_uninit();
+        this->initialized = false;
+    }
+
+  private:
+    /// @brief Fails if the object isn't constructed.
+    constexpr auto check_init() const noexcept {
+        if (not this->initialized) {
+            MAYBE_UNINIT_CHECK_FAILED("object accessed or destroyed before being constructed");
+        }
+    }
+
+    /// @brief Fails if the object is constructed.
+    constexpr auto check_uninit() const noexcept {
+        if (this->initialized) {
+            MAYBE_UNINIT_CHECK_FAILED("object constructed again before being destroyed");
+        }
+    }
+
+    /// @brief The wrapped object.
+    maybe_uninit<T> storage{};
+
+    /// @brief Whether the wrapped object is constructed.
+    bool initialized = false;
+};
+
+#else
+
+/// @brief `maybe_uninit`, as `MAYBE_UNINIT_CHECKED` is disabled.
+template <detail::sized T>
+using checked_maybe_uninit = maybe_uninit<T>;
+
+#endif
+
+/// @brief `maybe_uninit` whose size and alignment are rounded up to @p Align, so that objects in neighbouring
+/// `padded_maybe_uninit`s, e.g. in an array of per-thread counters, never share a cache line.
+/// @details Exposes the same API as `maybe_uninit`:
+/// @code {.cpp}
+///     auto counters = std::array<padded_maybe_uninit<Counter>, 8>{}; // one cache line each.
+///     counters[core].paren_init(0);
+/// @endcode
+/// @tparam T Type of the value.
+/// @tparam Align Alignment to round up to. Defaults to `MAYBE_UNINIT_CACHE_LINE_SIZE`, rather than
+/// `std::hardware_destructive_interference_size`, for ABI stability.
+/// @pre `T` is a complete [object](https://en.cppreference.com/w/cpp/types/is_object) type.
+template <detail::sized T, std::size_t Align = detail::cache_line_size>
+    requires(std::has_single_bit(Align))
+class alignas(std::max(Align, alignof(T))) padded_maybe_uninit {
+  public:
+    /// @brief Default constructor. Performs no initialization on the object.
+    constexpr padded_maybe_uninit() noexcept = default;
+
+    /// @brief Default initializes the object via `default_init()`.
+    /// @param[in] default_init_t Disambiguation tag.
+    explicit constexpr padded_maybe_uninit(default_init_t) noexcept(detail::nothrow_default_constructible<T>)
+        requires detail::default_constructible<T>
+        : storage(default_init_t{}) {}
+
+    /// @brief Initializes the object via `paren_init()`.
+    /// @param[in] paren_init_t Disambiguation tag.
+    /// @param args Arguments to forward to the constructor of the object.
+    template <typename... Args>
+    explicit constexpr padded_maybe_uninit(
+        paren_init_t,
+        Args&&... args
+    ) noexcept(detail::nothrow_paren_constructible_from<T, Args...>)
+        requires detail::paren_constructible_from<T, Args...>
+        : storage(paren_init_t{}, std::forward<Args>(args)...) {}
+
+    /// @brief Initializes the object via `brace_init()`.
+    /// @param[in] brace_init_t Disambiguation tag.
+    /// @param args Arguments to forward to the constructor of the object.
+    template <typename... Args>
+    explicit constexpr padded_maybe_uninit(
+        brace_init_t,
+        Args&&... args
+    ) noexcept(detail::nothrow_brace_constructible_from<T, Args...>)
+        requires detail::brace_constructible_from<T, Args...>
+        : storage(brace_init_t{}, std::forward<Args>(args)...) {}
+
+    /// @brief Initializes the object via `init_with()`.
+    /// @param[in] init_with_t Disambiguation tag.
+    /// @param f Invocable whose result to initialize the object with.
+    /// @param args Arguments to invoke @p f with.
+    template <typename F, typename... Args>
+    explicit constexpr padded_maybe_uninit(
+        init_with_t,
+        F&& f,
+        Args&&... args
+    ) noexcept(detail::nothrow_invoke_constructible_from<T, F, Args...>)
+        requires detail::invoke_constructible_from<T, F, Args...>
+        : storage(init_with_t{}, std::forward<F>(f), std::forward<Args>(args)...) {}
+
+    /// @brief See `maybe_uninit::default_init()`.
+    template <typename Self>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto default_init(this Self&& self) noexcept(detail::nothrow_default_constructible<T>) -> T&
+        requires detail::default_constructible<T>
+    {
+        return self.storage.default_init();
+    }
+
+    /// @brief See `maybe_uninit::paren_init()`.
+    template <typename Self, typename... Args>
+    constexpr auto
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    paren_init(this Self&& self, Args&&... args) noexcept(detail::nothrow_paren_constructible_from<T, Args...>) -> T&
+        requires detail::paren_constructible_from<T, Args...>
+    {
+        return self.storage.paren_init(std::forward<Args>(args)...);
+    }
+
+    /// @brief See `maybe_uninit::brace_init()`.
+    template <typename Self, typename... Args>
+    constexpr auto
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    brace_init(this Self&& self, Args&&... args) noexcept(detail::nothrow_brace_constructible_from<T, Args...>) -> T&
+        requires detail::brace_constructible_from<T, Args...>
+    {
+        return self.storage.brace_init(std::forward<Args>(args)...);
+    }
+
+    /// @brief See `maybe_uninit::init_with()`.
+    template <typename Self, typename F, typename... Args>
+    constexpr auto
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    init_with(this Self&& self, F&& f, Args&&... args) noexcept(
+        detail::nothrow_invoke_constructible_from<T, F, Args...>
+    ) -> T&
+        requires detail::invoke_constructible_from<T, F, Args...>
+    {
+        return self.storage.init_with(std::forward<F>(f), std::forward<Args>(args)...);
+    }
+
+    /// @brief See `maybe_uninit::ptr()`.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto ptr(this Self&& self) noexcept -> auto* {
+        return std::forward<Self>(self).storage.ptr();
+    }
+
+    /// @brief See `maybe_uninit::ref()`.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto ref(this Self&& self) noexcept -> auto&& {
+        return std::forward<Self>(self).storage.ref();
+    }
+
+    /// @brief See `maybe_uninit::bytes()`.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto bytes(this Self&& self) noexcept -> std::ranges::borrowed_range auto {
+        return std::forward<Self>(self).storage.bytes();
+    }
+
+    /// @brief See `maybe_uninit::destroy()`.
+    template <typename Self>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto destroy(this Self&& self) noexcept(std::is_nothrow_destructible_v<T>) {
+        self.storage.destroy();
+    }
+
+    /// @brief See `maybe_uninit::relocate_into()`.
+    template <typename Self>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto relocate_into(this Self&& self, padded_maybe_uninit& dst) noexcept(detail::nothrow_relocatable<T>)
+        -> T&
+        requires detail::relocatable<T>
+    {
+        return self.storage.relocate_into(dst.storage);
+    }
+
+    /// @brief See `maybe_uninit::relocate_from()`.
+    template <typename Self>
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto relocate_from(this Self&& self, padded_maybe_uninit& src) noexcept(detail::nothrow_relocatable<T>)
+        -> T&
+        requires detail::relocatable<T>
+    {
+        return src.relocate_into(self);
+    }
+
+    /// @brief See `maybe_uninit::assume_init_from_bytes()`.
+    auto assume_init_from_bytes() noexcept -> T&
+        requires detail::implicit_lifetime<T>
+    {
+        return this->storage.assume_init_from_bytes();
+    }
+
+    /// @brief See `maybe_uninit::assume_init()`.
+    constexpr auto assume_init() noexcept {
+        this->storage.assume_init();
+    }
+
+    /// @brief See `maybe_uninit::assume_uninit()`.
+    constexpr auto assume_uninit() noexcept {
+        this->storage.assume_uninit();
+    }
+
+  private:
+    /// @brief The wrapped object.
+    maybe_uninit<T> storage{};
+};
+
+/// @brief Allocates an array of @p n `padded_maybe_uninit<T, Align>`s, one per hardware thread by default, performing
+/// no initialization on them.
+/// @details Meant for per-thread or per-core state, where each thread only touches its own slot:
+/// @code {.cpp}
+///     auto counters = make_per_core<Counter>();
+///     counters[core].paren_init(0);
+/// @endcode
+/// @note Propagates exceptions thrown by `operator new[]`.
+/// @relatedalso padded_maybe_uninit
+template <detail::sized T, std::size_t Align = detail::cache_line_size>
+[[nodiscard]]
+auto make_per_core(std::size_t const n = std::max(std::thread::hardware_concurrency(), 1U))
+    -> std::unique_ptr<padded_maybe_uninit<T, Align>[]> {
+    return std::make_unique_for_overwrite<padded_maybe_uninit<T, Align>[]>(n);
+}
+
 } // namespace MAYBE_UNINIT_NAMESPACE
@@ -0,0 +1,264 @@
+/// @file
+/// @brief Benchmarks `maybe_uninit` against `std::optional`, hand-written unions, `alignas` byte arrays with placement
+/// new, and `std::vector::reserve`. Not part of the library: compile it on its own, with optimizations, e.g. with
+/// `c++ -std=c++26 -O2 -DNDEBUG maybe_uninit_bench.cpp -o maybe_uninit_bench`.
+/// @details Each storage holds `slot_count` slots of a trivial type, a small non-trivial type and a large type, and is
+/// measured on three workloads:
+/// - `construct`: constructing and destroying an object in a single slot, over and over;
+/// - `array`: creating a storage, then constructing every slot, then destroying them in reverse order;
+/// - `relocate`: moving every object to another storage and destroying the originals, back and forth.
+///
+/// Times are the best of several runs, in nanoseconds per element. Requires GCC or Clang, for the inline assembly
+/// which keeps the compiler from discarding the work.
+
+#include "maybe_uninit.hpp"
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <optional>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace maybe_uninit_bench {
+
+using namespace MAYBE_UNINIT_NAMESPACE;
+
+/// @brief Number of slots of every storage.
+inline constexpr auto slot_count = std::size_t{256};
+
+/// @brief Number of times each workload is repeated per run.
+inline constexpr auto repetitions = std::size_t{1} << 14;
+
+/// @brief Number of runs, of which the fastest is reported.
+inline constexpr auto runs = 5;
+
+/// @brief Large trivially copyable type.
+struct large {
+    std::array<std::uint64_t, 32> words{};
+};
+
+/// @brief Makes the compiler assume @p value is read and written, so that the work producing it isn't discarded.
+template <typename T>
+auto clobber(T& value) noexcept {
+    asm volatile("" : : "g"(std::addressof(value)) : "memory");
+}
+
+/// @brief Slots of a `std::array<maybe_uninit<T>, slot_count>`, relocated with `relocate_all()`.
+template <typename T>
+class maybe_uninit_slots {
+  public:
+    static constexpr auto name = "maybe_uninit";
+
+    auto emplace(std::size_t const i, T const& value) -> T& {
+        return this->slots[i].paren_init(value);
+    }
+
+    auto destroy(std::size_t const i) noexcept {
+        this->slots[i].destroy();
+    }
+
+    auto relocate_to(maybe_uninit_slots& other) noexcept {
+        relocate_all(this->slots, other.slots);
+    }
+
+  private:
+    std::array<maybe_uninit<T>, slot_count> slots;
+};
+
+/// @brief Slots of a `std::array<std::optional<T>, slot_count>`.
+template <typename T>
+class optional_slots {
+  public:
+    static constexpr auto name = "std::optional";
+
+    auto emplace(std::size_t const i, T const& value) -> T& {
+        return this->slots[i].emplace(value);
+    }
+
+    auto destroy(std::size_t const i) noexcept {
+        this->slots[i].reset();
+    }
+
+    auto relocate_to(optional_slots& other) noexcept {
+        for (auto i = std::size_t{0}; i != slot_count; ++i) {
+            other.slots[i].emplace(std::move(*this->slots[i]));
+            this->slots[i].reset();
+        }
+    }
+
+  private:
+    std::array<std::optional<T>, slot_count> slots;
+};
+
+/// @brief Slots of an array of hand-written unions, whose constructor and destructor do nothing.
+template <typename T>
+class union_slots {
+  public:
+    static constexpr auto name = "union";
+
+    auto emplace(std::size_t const i, T const& value) -> T& {
+        return *::new (std::addressof(this->slots[i].value)) T(value);
+    }
+
+    auto destroy(std::size_t const i) noexcept {
+        this->slots[i].value.~T();
+    }
+
+    auto relocate_to(union_slots& other) noexcept {
+        for (auto i = std::size_t{0}; i != slot_count; ++i) {
+            ::new (std::addressof(other.slots[i].value)) T(std::move(this->slots[i].value));
+            this->slots[i].value.~T();
+        }
+    }
+
+  private:
+    union slot {
+        slot() noexcept {}
+        ~slot() {}
+        T value;
+    };
+
+    std::array<slot, slot_count> slots;
+};
+
+/// @brief Slots of an `alignas(T)` byte array, constructed with placement new.
+template <typename T>
+class byte_array_slots {
+  public:
+    static constexpr auto name = "alignas byte array";
+
+    auto emplace(std::size_t const i, T const& value) -> T& {
+        return *::new (this->bytes + i * sizeof(T)) T(value);
+    }
+
+    auto destroy(std::size_t const i) noexcept {
+        this->at(i).~T();
+    }
+
+    auto relocate_to(byte_array_slots& other) noexcept {
+        for (auto i = std::size_t{0}; i != slot_count; ++i) {
+            ::new (other.bytes + i * sizeof(T)) T(std::move(this->at(i)));
+            this->at(i).~T();
+        }
+    }
+
+  private:
+    auto at(std::size_t const i) noexcept -> T& {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return *std::launder(reinterpret_cast<T*>(this->bytes + i * sizeof(T)));
+    }
+
+    alignas(T) std::byte bytes[slot_count * sizeof(T)];
+};
+
+/// @brief Slots of a `std::vector<T>` reserved upfront, whose slots are constructed and destroyed at its end.
+template <typename T>
+class vector_slots {
+  public:
+    static constexpr auto name = "std::vector::reserve";
+
+    vector_slots() {
+        this->values.reserve(slot_count);
+    }
+
+    auto emplace(std::size_t, T const& value) -> T& {
+        return this->values.emplace_back(value);
+    }
+
+    auto destroy(std::size_t) noexcept {
+        this->values.pop_back();
+    }
+
+    auto relocate_to(vector_slots& other) noexcept {
+        other.values.assign(
+            std::make_move_iterator(this->values.begin()),
+            std::make_move_iterator(this->values.end())
+        );
+        this->values.clear();
+    }
+
+  private:
+    std::vector<T> values;
+};
+
+/// @brief Returns the fastest of `runs` runs of @p workload, which processes `repetitions * slot_count` elements, in
+/// nanoseconds per element.
+template <typename F>
+auto measure(F workload) -> double {
+    auto best = std::chrono::nanoseconds::max();
+    for (auto run = 0; run != runs; ++run) {
+        auto const start = std::chrono::steady_clock::now();
+        workload();
+        auto const elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed));
+    }
+    return static_cast<double>(best.count()) / static_cast<double>(repetitions * slot_count);
+}
+
+/// @brief Measures the workloads on `Slots<T>`, whose objects are copies of @p value, and prints the results.
+template <template <typename> typename Slots, typename T>
+auto run(char const* const type_name, T const& value) {
+    auto const construct = measure([&] {
+        auto slots = std::make_unique_for_overwrite<Slots<T>>();
+        for (auto r = std::size_t{0}; r != repetitions * slot_count; ++r) {
+            clobber(slots->emplace(0, value));
+            slots->destroy(0);
+        }
+    });
+    auto const array = measure([&] {
+        for (auto r = std::size_t{0}; r != repetitions; ++r) {
+            Slots<T> slots; // default-initialized, as value-initialization would zero the slots of some storages.
+            for (auto i = std::size_t{0}; i != slot_count; ++i) {
+                slots.emplace(i, value);
+            }
+            clobber(slots);
+            for (auto i = slot_count; i != 0; --i) {
+                slots.destroy(i - 1);
+            }
+        }
+    });
+    auto const relocate = measure([&] {
+        auto from = std::make_unique_for_overwrite<Slots<T>>();
+        auto to = std::make_unique_for_overwrite<Slots<T>>();
+        for (auto i = std::size_t{0}; i != slot_count; ++i) {
+            from->emplace(i, value);
+        }
+        for (auto r = std::size_t{0}; r != repetitions; ++r) {
+            from->relocate_to(*to);
+            clobber(*to);
+            std::swap(from, to);
+        }
+        for (auto i = slot_count; i != 0; --i) {
+            from->destroy(i - 1);
+        }
+    });
+    std::printf("%-14s %-22s %10.2f %10.2f %10.2f\n", type_name, Slots<T>::name, construct, array, relocate);
+}
+
+/// @brief Measures every storage of `T`s.
+template <typename T>
+auto run_all(char const* const type_name, T const& value) {
+    run<maybe_uninit_slots>(type_name, value);
+    run<optional_slots>(type_name, value);
+    run<union_slots>(type_name, value);
+    run<byte_array_slots>(type_name, value);
+    run<vector_slots>(type_name, value);
+}
+
+} // namespace maybe_uninit_bench
+
+int main() {
+    using namespace maybe_uninit_bench;
+    std::printf("%-14s %-22s %10s %10s %10s  (ns/element)\n", "type", "storage", "construct", "array", "relocate");
+    run_all<std::uint64_t>("uint64_t", 42);
+    run_all<std::string>("std::string", std::string("short string"));
+    run_all<large>("large (256 B)", large{});
+}
@@ -0,0 +1,74 @@
+/// @file
+/// @brief Checks the guarantees of `maybe_uninit` which code relying on it to avoid hidden stores, constructor calls
+/// and destructor calls depends on. Not part of the library: run `check_codegen.sh`, which compiles it.
+/// @details Layout and triviality are checked by the `static_assert`s below, which fail the compilation if broken.
+/// Codegen is checked by `check_codegen.sh`, which compiles the `probe_*` functions at `-O2` with GCC and Clang, and
+/// fails if their assembly holds a `memset`, a call to `non_trivial_probe`'s constructor or destructor, or if
+/// `probe_destroy_trivial` compiles to anything but a return.
+
+#include "maybe_uninit.hpp"
+
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+
+namespace maybe_uninit_checks {
+
+using namespace MAYBE_UNINIT_NAMESPACE;
+
+/// @brief Type with non-trivial special member functions, which are never defined, so that calls to them would show
+/// in the assembly and fail to link.
+struct non_trivial_probe {
+    non_trivial_probe();
+    non_trivial_probe(non_trivial_probe const&);
+    non_trivial_probe(non_trivial_probe&&) noexcept;
+    auto operator=(non_trivial_probe const&) -> non_trivial_probe&;
+    auto operator=(non_trivial_probe&&) noexcept -> non_trivial_probe&;
+    ~non_trivial_probe();
+};
+
+static_assert(sizeof(maybe_uninit<int>) == sizeof(int) and alignof(maybe_uninit<int>) == alignof(int));
+static_assert(sizeof(maybe_uninit<std::byte[65'536]>) == 65'536);
+static_assert(sizeof(maybe_uninit<non_trivial_probe>) == sizeof(non_trivial_probe));
+static_assert(std::is_trivially_destructible_v<maybe_uninit<int>>);
+static_assert(std::is_trivially_copyable_v<maybe_uninit<int>>);
+static_assert(std::is_nothrow_default_constructible_v<maybe_uninit<non_trivial_probe>>);
+static_assert(not std::is_copy_constructible_v<maybe_uninit<non_trivial_probe>>);
+static_assert(noexcept(std::declval<maybe_uninit<int>&>().destroy()));
+static_assert(sizeof(padded_maybe_uninit<int>) == detail::cache_line_size);
+static_assert(alignof(padded_maybe_uninit<int>) == detail::cache_line_size);
+static_assert(std::is_trivially_copyable_v<padded_maybe_uninit<int>>);
+
+/// @brief Plain old data type, whose default initialization performs no initialization.
+struct pod_probe {
+    int fields[64];
+};
+
+/// @brief Must compile to no `memset` and no store to @p buffer before it's passed on.
+void probe_uninit_array(void (*consume)(std::array<maybe_uninit<std::byte>, 4'096>&)) {
+    auto buffer = std::array<maybe_uninit<std::byte>, 4'096>{};
+    consume(buffer);
+}
+
+/// @brief Must compile to no call to `non_trivial_probe`'s constructor or destructor.
+void probe_non_trivial_slots(void (*consume)(std::array<maybe_uninit<non_trivial_probe>, 16>&)) {
+    auto slots = std::array<maybe_uninit<non_trivial_probe>, 16>{};
+    consume(slots);
+}
+
+/// @brief Must compile to no `memset`, as default initialization of a POD performs no initialization.
+void probe_default_init_pod(void (*consume)(std::array<maybe_uninit<pod_probe>, 16>&)) {
+    auto slots = std::array<maybe_uninit<pod_probe>, 16>{};
+    for (auto& slot : slots) {
+        slot.default_init();
+    }
+    consume(slots);
+}
+
+/// @brief Must compile to a mere return, as destroying a trivially destructible object does nothing.
+void probe_destroy_trivial(maybe_uninit<int>& slot) {
+    slot.destroy();
+}
+
+} // namespace maybe_uninit_checks
@@ -0,0 +1,249 @@
+/// @file
+/// @brief Defines the template type `mpmc_queue`, a bounded multi-producer multi-consumer queue whose cells hold
+/// `maybe_uninit` payloads.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <array>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+/// @brief Bounded multi-producer multi-consumer queue of up to @p N elements, after Dmitry Vyukov's design.
+/// @details Each cell holds a sequence number and a `maybe_uninit<T>` payload, so `T` needn't be default constructible
+/// and each element is constructed exactly once. The sequence number tells producers and consumers whether the cell is
+/// free or full for the current lap, so that claiming a cell takes a single compare-and-swap and no locks are taken.
+/// Cells are padded to a cache line to avoid false sharing between threads working on neighbouring cells.
+/// @details The `try_*` functions never block. `emplace()` and `pop()` claim a cell unconditionally, and wait on its
+/// sequence number via `std::atomic::wait` until it's ready:
+/// @code {.cpp}
+///     auto tasks = std::make_unique<mpmc_queue<Task, 4096>>();
+///
+///     // Any producer thread.
+///     if (not tasks->try_emplace(function, arguments)) {
+///         run_inline(function, arguments);
+///     }
+///
+///     // Any consumer thread.
+///     Task task = tasks->pop();
+/// @endcode
+/// @tparam T Type of the elements.
+/// @tparam N Maximum number of elements. Must be a power of 2.
+/// @note Elements whose selected constructor may throw are constructed before a cell is claimed and then relocated
+/// into it, as a claimed cell can't be given back.
+template <detail::sized T, std::size_t N>
+    requires(N >= 2 and std::has_single_bit(N) and detail::nothrow_relocatable<T>)
+class mpmc_queue {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /// @brief Default constructor. Constructs an empty queue, performing no initialization on the payloads.
+    mpmc_queue() noexcept {
+        for (auto i = size_type{0}; i != N; ++i) {
+            this->cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+    }
+
+    mpmc_queue(mpmc_queue const&) = delete;
+    mpmc_queue(mpmc_queue&&) = delete;
+    auto operator=(mpmc_queue const&) -> mpmc_queue& = delete;
+    auto operator=(mpmc_queue&&) -> mpmc_queue& = delete;
+
+    /// @brief Destructor. Destroys the elements which were pushed but not popped.
+    /// @pre No thread is accessing the queue.
+    ~mpmc_queue() {
+        auto const last = this->enqueue_pos.load(std::memory_order_relaxed);
+        for (auto pos = this->dequeue_pos.load(std::memory_order_relaxed); pos != last; ++pos) {
+            auto& cell = this->cells[pos & mask];
+            if (cell.sequence.load(std::memory_order_relaxed) == pos + 1) {
+                cell.payload.destroy();
+            }
+        }
+    }
+
+    /// @brief Returns the maximum number of elements, i.e. @p N.
+    [[nodiscard]]
+    static constexpr auto capacity() noexcept -> size_type {
+        return N;
+    }
+
+    /// @brief Constructs an element at the back as if by `T(std::forward<Args>(args)...)`, if the queue isn't full.
+    /// @returns Whether the element was pushed.
+    /// @note Propagates exceptions thrown by `T`'s selected constructor, in which case nothing is pushed.
+    template <typename... Args>
+    auto try_emplace(Args&&... args) noexcept(detail::nothrow_paren_constructible_from<T, Args...>) -> bool
+        requires detail::paren_constructible_from<T, Args...>
+    {
+        if constexpr (detail::nothrow_paren_constructible_from<T, Args...>) {
+            auto pos = size_type{0};
+            auto* const cell = this->try_claim_push(pos);
+            if (cell == nullptr) {
+                return false;
+            }
+            cell->payload.paren_init(std::forward<Args>(args)...);
+            publish(*cell, pos + 1);
+            return true;
+        } else {
+            auto staged = maybe_uninit<T>(paren_init_t{}, std::forward<Args>(args)...);
+            auto pos = size_type{0};
+            auto* const cell = this->try_claim_push(pos);
+            if (cell == nullptr) {
+                staged.destroy();
+                return false;
+            }
+            staged.relocate_into(cell->payload);
+            publish(*cell, pos + 1);
+            return true;
+        }
+    }
+
+    /// @brief Constructs an element at the back as if by `T(std::forward<Args>(args)...)`, waiting for a cell to be
+    /// freed if the queue is full.
+    /// @note Propagates exceptions thrown by `T`'s selected constructor, in which case nothing is pushed.
+    template <typename... Args>
+    auto emplace(Args&&... args) noexcept(detail::nothrow_paren_constructible_from<T, Args...>)
+        requires detail::paren_constructible_from<T, Args...>
+    {
+        if constexpr (detail::nothrow_paren_constructible_from<T, Args...>) {
+            auto const pos = this->enqueue_pos.fetch_add(1, std::memory_order_relaxed);
+            auto& cell = wait_for(pos, pos);
+            cell.payload.paren_init(std::forward<Args>(args)...);
+            publish(cell, pos + 1);
+        } else {
+            auto staged = maybe_uninit<T>(paren_init_t{}, std::forward<Args>(args)...);
+            auto const pos = this->enqueue_pos.fetch_add(1, std::memory_order_relaxed);
+            auto& cell = wait_for(pos, pos);
+            staged.relocate_into(cell.payload);
+            publish(cell, pos + 1);
+        }
+    }
+
+    /// @brief Relocates the front element into @p dst, if the queue isn't empty.
+    /// @returns Whether an element was popped.
+    /// @attention @p dst is assumed not to hold an object.
+    auto try_pop(maybe_uninit<T>& dst) noexcept -> bool {
+        auto pos = size_type{0};
+        auto* const cell = this->try_claim_pop(pos);
+        if (cell == nullptr) {
+            return false;
+        }
+        cell->payload.relocate_into(dst);
+        publish(*cell, pos + N);
+        return true;
+    }
+
+    /// @brief Move assigns the front element to @p dst, if the queue isn't empty.
+    /// @returns Whether an element was popped.
+    auto try_pop(T& dst) noexcept -> bool
+        requires std::is_nothrow_move_assignable_v<T>
+    {
+        auto pos = size_type{0};
+        auto* const cell = this->try_claim_pop(pos);
+        if (cell == nullptr) {
+            return false;
+        }
+        dst = std::move(cell->payload.ref());
+        cell->payload.destroy();
+        publish(*cell, pos + N);
+        return true;
+    }
+
+    /// @brief Moves the front element out, waiting for one to be pushed if the queue is empty.
+    /// @returns The popped element.
+    [[nodiscard]]
+    auto pop() noexcept -> T
+        requires std::is_nothrow_move_constructible_v<T>
+    {
+        auto const pos = this->dequeue_pos.fetch_add(1, std::memory_order_relaxed);
+        auto& cell = wait_for(pos, pos + 1);
+        auto result = T(std::move(cell.payload.ref()));
+        cell.payload.destroy();
+        publish(cell, pos + N);
+        return result;
+    }
+
+  private:
+    /// @brief Cell of the queue. Its sequence number is `pos` when free for the producer of position `pos`, and
+    /// `pos + 1` when full for the consumer of position `pos`.
+    struct alignas(detail::cache_line_size) cell_type {
+        std::atomic<size_type> sequence;
+        maybe_uninit<T> payload;
+    };
+
+    static constexpr auto mask = N - 1;
+
+    /// @brief Claims the cell of the next push position, storing the position in @p pos.
+    /// @returns The claimed cell, or `nullptr` if the queue is full.
+    auto try_claim_push(size_type& pos) noexcept -> cell_type* {
+        pos = this->enqueue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = this->cells[pos & mask];
+            auto const lap = static_cast<std::ptrdiff_t>(cell.sequence.load(std::memory_order_acquire) - pos);
+            if (lap == 0) {
+                if (this->enqueue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return std::addressof(cell);
+                }
+            } else if (lap < 0) {
+                return nullptr;
+            } else {
+                pos = this->enqueue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// @brief Claims the cell of the next pop position, storing the position in @p pos.
+    /// @returns The claimed cell, or `nullptr` if the queue is empty.
+    auto try_claim_pop(size_type& pos) noexcept -> cell_type* {
+        pos = this->dequeue_pos.load(std::memory_order_relaxed);
+        while (true) {
+            auto& cell = this->cells[pos & mask];
+            auto const lap = static_cast<std::ptrdiff_t>(cell.sequence.load(std::memory_order_acquire) - (pos + 1));
+            if (lap == 0) {
+                if (this->dequeue_pos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    return std::addressof(cell);
+                }
+            } else if (lap < 0) {
+                return nullptr;
+            } else {
+                pos = this->dequeue_pos.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /// @brief Waits until the sequence number of the cell of position @p pos is @p sequence.
+    /// @returns The cell.
+    auto wait_for(size_type const pos, size_type const sequence) noexcept -> cell_type& {
+        auto& cell = this->cells[pos & mask];
+        for (auto current = cell.sequence.load(std::memory_order_acquire); current != sequence;
+             current = cell.sequence.load(std::memory_order_acquire)) {
+            cell.sequence.wait(current, std::memory_order_relaxed);
+        }
+        return cell;
+    }
+
+    /// @brief Hands @p cell over to the other side by setting its sequence number to @p sequence, and wakes up the
+    /// threads waiting on it.
+    static auto publish(cell_type& cell, size_type const sequence) noexcept {
+        cell.sequence.store(sequence, std::memory_order_release);
+        cell.sequence.notify_all();
+    }
+
+    /// @brief Next push position. Written by producers.
+    alignas(detail::cache_line_size) std::atomic<size_type> enqueue_pos = 0;
+
+    /// @brief Next pop position. Written by consumers.
+    alignas(detail::cache_line_size) std::atomic<size_type> dequeue_pos = 0;
+
+    /// @brief The cells.
+    std::array<cell_type, N> cells{};
+};
+
+} // namespace MAYBE_UNINIT_NAMESPACE
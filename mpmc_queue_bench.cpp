@@ -0,0 +1,180 @@
+/// @file
+/// @brief Benchmarks `mpmc_queue` against a `std::deque` guarded by a `std::mutex`. Not part of the library: compile
+/// it on its own, with optimizations, e.g. with `c++ -std=c++26 -O2 -DNDEBUG -pthread mpmc_queue_bench.cpp -o
+/// mpmc_queue_bench`.
+/// @details Each queue is bounded to `queue_capacity` elements of type `std::uint64_t`, and measured with 1, 2, 4, up to
+/// 64 producer threads, or up to the number given as the first argument, and as many consumer threads. Producers push
+/// `item_count` elements in total, split evenly between them, while consumers pop as many, waiting when the queue is
+/// full or empty. `mpmc_queue` is measured twice: blocking, with `emplace()` and `pop()`, which wait on the sequence
+/// number of their cell, and non-blocking, with `try_emplace()` and `try_pop()`, retried after yielding. The baseline
+/// waits on condition variables.
+///
+/// Times are the best of several runs, in nanoseconds per element, from the moment every thread is ready to the moment
+/// every element is popped. Requires GCC or Clang, for the inline assembly which keeps the compiler from discarding the
+/// work.
+
+#include "mpmc_queue.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <latch>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace mpmc_queue_bench {
+
+using namespace MAYBE_UNINIT_NAMESPACE;
+
+/// @brief Maximum number of elements of every queue.
+inline constexpr auto queue_capacity = std::size_t{4'096};
+
+/// @brief Number of elements pushed and popped per run.
+inline constexpr auto item_count = std::size_t{1} << 22;
+
+/// @brief Default largest number of producer threads, and of consumer threads.
+inline constexpr auto max_thread_count = std::size_t{64};
+
+/// @brief Number of runs, of which the fastest is reported.
+inline constexpr auto runs = 5;
+
+/// @brief Makes the compiler assume @p value is read and written, so that the work producing it isn't discarded.
+template <typename T>
+auto clobber(T& value) noexcept {
+    asm volatile("" : : "g"(std::addressof(value)) : "memory");
+}
+
+/// @brief `mpmc_queue<std::uint64_t, queue_capacity>`, pushed with `emplace()` and popped with `pop()`.
+class blocking_queue {
+  public:
+    static constexpr auto name = "mpmc_queue";
+
+    auto push(std::uint64_t const value) noexcept {
+        this->queue.emplace(value);
+    }
+
+    auto pop() noexcept -> std::uint64_t {
+        return this->queue.pop();
+    }
+
+  private:
+    mpmc_queue<std::uint64_t, queue_capacity> queue;
+};
+
+/// @brief `mpmc_queue<std::uint64_t, queue_capacity>`, pushed with `try_emplace()` and popped with `try_pop()`, which
+/// are retried after yielding until they succeed.
+class spinning_queue {
+  public:
+    static constexpr auto name = "mpmc_queue (try_*)";
+
+    auto push(std::uint64_t const value) noexcept {
+        while (not this->queue.try_emplace(value)) {
+            std::this_thread::yield();
+        }
+    }
+
+    auto pop() noexcept -> std::uint64_t {
+        auto value = std::uint64_t{0};
+        while (not this->queue.try_pop(value)) {
+            std::this_thread::yield();
+        }
+        return value;
+    }
+
+  private:
+    mpmc_queue<std::uint64_t, queue_capacity> queue;
+};
+
+/// @brief `std::deque<std::uint64_t>` bounded to `queue_capacity` elements, guarded by a `std::mutex`, whose producers
+/// and consumers wait on condition variables.
+class mutex_queue {
+  public:
+    static constexpr auto name = "std::mutex + std::deque";
+
+    auto push(std::uint64_t const value) {
+        auto lock = std::unique_lock(this->mutex);
+        this->not_full.wait(lock, [this] { return this->values.size() < queue_capacity; });
+        this->values.push_back(value);
+        lock.unlock();
+        this->not_empty.notify_one();
+    }
+
+    auto pop() -> std::uint64_t {
+        auto lock = std::unique_lock(this->mutex);
+        this->not_empty.wait(lock, [this] { return not this->values.empty(); });
+        auto const value = this->values.front();
+        this->values.pop_front();
+        lock.unlock();
+        this->not_full.notify_one();
+        return value;
+    }
+
+  private:
+    std::mutex mutex;
+    std::condition_variable not_full;
+    std::condition_variable not_empty;
+    std::deque<std::uint64_t> values;
+};
+
+/// @brief Returns the fastest of `runs` runs of @p thread_count producers and as many consumers exchanging
+/// `item_count` elements through a `Queue`, in nanoseconds per element.
+template <typename Queue>
+auto measure(std::size_t const thread_count) -> double {
+    auto best = std::chrono::nanoseconds::max();
+    auto const items_per_thread = item_count / thread_count;
+    for (auto run = 0; run != runs; ++run) {
+        auto queue = std::make_unique<Queue>();
+        auto ready = std::latch(static_cast<std::ptrdiff_t>(thread_count * 2 + 1));
+        auto threads = std::vector<std::jthread>();
+        threads.reserve(thread_count * 2);
+        for (auto t = std::size_t{0}; t != thread_count; ++t) {
+            threads.emplace_back([&] {
+                ready.arrive_and_wait();
+                for (auto i = std::size_t{0}; i != items_per_thread; ++i) {
+                    queue->push(i);
+                }
+            });
+            threads.emplace_back([&] {
+                ready.arrive_and_wait();
+                auto sum = std::uint64_t{0};
+                for (auto i = std::size_t{0}; i != items_per_thread; ++i) {
+                    sum += queue->pop();
+                }
+                clobber(sum);
+            });
+        }
+        ready.arrive_and_wait();
+        auto const start = std::chrono::steady_clock::now();
+        threads.clear();
+        auto const elapsed = std::chrono::steady_clock::now() - start;
+        best = std::min(best, std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed));
+    }
+    return static_cast<double>(best.count()) / static_cast<double>(items_per_thread * thread_count);
+}
+
+} // namespace mpmc_queue_bench
+
+int main(int const argc, char** const argv) {
+    using namespace mpmc_queue_bench;
+    auto const max_threads = argc > 1 ? std::strtoull(argv[1], nullptr, 10) : max_thread_count;
+    std::printf(
+        "%10s %24s %24s %24s  (ns/element)\n",
+        "producers",
+        blocking_queue::name,
+        spinning_queue::name,
+        mutex_queue::name
+    );
+    for (auto t = std::size_t{1}; t <= max_threads; t *= 2) {
+        auto const blocking = measure<blocking_queue>(t);
+        auto const spinning = measure<spinning_queue>(t);
+        auto const mutex = measure<mutex_queue>(t);
+        std::printf("%10zu %24.2f %24.2f %24.2f\n", t, blocking, spinning, mutex);
+    }
+}
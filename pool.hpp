@@ -0,0 +1,188 @@
+/// @file
+/// @brief Defines the template type `pool`, an object pool whose free list is stored inside its unconstructed
+/// `maybe_uninit` slots.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+namespace detail {
+
+/// @brief Slot of a `pool`. While free, it holds a pointer to the next free slot. While acquired, it holds a
+/// `maybe_uninit<T>`, which is pointer-interconvertible with both the slot and the object.
+template <typename T>
+union pool_slot {
+    /// @brief Constructs a free slot with no successor.
+    constexpr pool_slot() noexcept
+        : next(nullptr) {}
+
+    constexpr pool_slot(pool_slot const&) = delete;
+    constexpr pool_slot(pool_slot&&) = delete;
+    constexpr auto operator=(pool_slot const&) -> pool_slot& = delete;
+    constexpr auto operator=(pool_slot&&) -> pool_slot& = delete;
+
+    /// @brief Destructor. Performs no destruction, as the slot can't know whether its object is constructed.
+    constexpr ~pool_slot() {}
+
+    /// @brief Storage of the object, active while the slot is acquired.
+    maybe_uninit<T> storage;
+
+    /// @brief Next free slot, active while the slot is free.
+    pool_slot* next;
+};
+
+} // namespace detail
+
+/// @brief Object pool with O(1) acquisition and release, and no per-slot metadata.
+/// @details Slots are allocated in chunks of a fixed number of slots. Free slots form an intrusive singly linked list,
+/// whose links are stored in the dead storage of the slots themselves, so each slot is only as large as the larger of
+/// `T` and a pointer. Slots of a fresh chunk are handed out in order, without threading them through the free list
+/// first, so allocating a chunk doesn't touch its memory:
+/// @code {.cpp}
+///     auto connections = pool<Connection>(1024); // chunks of 1024 slots, allocated on demand.
+///     Connection* c = connections.emplace(fd);   // acquires a slot and constructs via paren_init().
+///     // ...
+///     connections.destroy(*c);                   // destroys and returns the slot to the free list.
+///
+///     maybe_uninit<Connection>* slot = connections.acquire(); // acquires an unconstructed slot.
+///     slot->paren_init(fd);
+/// @endcode
+/// @tparam T Type of the objects.
+/// @attention Like `maybe_uninit`, `pool` doesn't destroy the objects it holds. It's up to the caller to ensure every
+/// acquired slot is released before the pool is destroyed.
+template <detail::sized T>
+class pool {
+  public:
+    using size_type = std::size_t;
+
+    /// @brief Constructs a pool which allocates slots in chunks of @p chunk_size, up to @p max_chunks chunks. No chunk
+    /// is allocated until a slot is first acquired.
+    /// @pre `chunk_size > 0`.
+    explicit pool(size_type const chunk_size, size_type const max_chunks = std::numeric_limits<size_type>::max())
+        : chunk_size(chunk_size)
+        , max_chunks(max_chunks) {}
+
+    pool(pool const&) = delete;
+    pool(pool&&) = delete;
+    auto operator=(pool const&) -> pool& = delete;
+    auto operator=(pool&&) -> pool& = delete;
+
+    /// @brief Destructor. Releases every chunk, without destroying the objects they may hold.
+    ~pool() {
+        for (auto* const chunk : this->chunks) {
+            allocator_type().deallocate(chunk, this->chunk_size);
+        }
+    }
+
+    /// @brief Acquires a slot whose object is unconstructed, allocating a new chunk if no slot is free.
+    /// @returns The acquired slot, or `nullptr` if no slot is free and `max_chunks` chunks have been allocated.
+    /// @note Propagates exceptions thrown by the allocator.
+    [[nodiscard]]
+    auto acquire() -> maybe_uninit<T>* {
+        auto* slot = this->free_head;
+        if (slot != nullptr) {
+            this->free_head = slot->next;
+        } else {
+            if (this->fresh == this->fresh_end and not this->grow()) {
+                return nullptr;
+            }
+            slot = std::construct_at(this->fresh++);
+        }
+        return std::construct_at(std::addressof(slot->storage));
+    }
+
+    /// @brief Acquires a slot and constructs its object as if by `T(std::forward<Args>(args)...)`.
+    /// @returns A pointer to the constructed object, or `nullptr` if no slot is free and `max_chunks` chunks have been
+    /// allocated.
+    /// @note Propagates exceptions thrown by the allocator, and by `T`'s selected constructor after releasing the slot.
+    template <typename... Args>
+    [[nodiscard]]
+    auto emplace(Args&&... args) -> T*
+        requires detail::paren_constructible_from<T, Args...>
+    {
+        auto* const slot = this->acquire();
+        if (slot == nullptr) {
+            return nullptr;
+        }
+        try {
+            return std::addressof(slot->paren_init(std::forward<Args>(args)...));
+        } catch (...) {
+            this->release(*slot);
+            throw;
+        }
+    }
+
+    /// @brief Returns @p slot to the free list.
+    /// @pre @p slot was acquired from this pool, and its object isn't constructed.
+    auto release(maybe_uninit<T>& slot) noexcept {
+        // maybe_uninit<T> is the first member of the slot union, so they're pointer-interconvertible.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto* const free_slot = reinterpret_cast<slot_type*>(std::addressof(slot));
+        detail::unpoison(std::addressof(slot));
+        free_slot->next = this->free_head;
+        this->free_head = free_slot;
+    }
+
+    /// @brief Destroys @p object and returns its slot to the free list.
+    /// @pre @p object was constructed in a slot acquired from this pool.
+    auto destroy(T& object) noexcept(std::is_nothrow_destructible_v<T>) {
+        // T is the only member of maybe_uninit<T>, so they're pointer-interconvertible.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        auto& slot = *reinterpret_cast<maybe_uninit<T>*>(std::addressof(object));
+        slot.destroy();
+        this->release(slot);
+    }
+
+    /// @brief Returns the number of slots allocated so far, both free and acquired.
+    [[nodiscard]]
+    auto capacity() const noexcept -> size_type {
+        return this->chunks.size() * this->chunk_size;
+    }
+
+  private:
+    using slot_type = detail::pool_slot<T>;
+    using allocator_type = std::allocator<slot_type>;
+
+    /// @brief Allocates a new chunk, whose slots become the fresh slots.
+    /// @returns Whether a chunk was allocated, i.e. whether fewer than `max_chunks` chunks were allocated before.
+    auto grow() -> bool {
+        if (this->chunks.size() == this->max_chunks) {
+            return false;
+        }
+        this->chunks.reserve(this->chunks.size() + 1);
+        auto* const chunk = allocator_type().allocate(this->chunk_size);
+        this->chunks.push_back(chunk);
+        this->fresh = chunk;
+        this->fresh_end = chunk + this->chunk_size;
+        return true;
+    }
+
+    /// @brief Number of slots per chunk.
+    size_type chunk_size;
+
+    /// @brief Maximum number of chunks.
+    size_type max_chunks;
+
+    /// @brief Every chunk allocated so far.
+    std::vector<slot_type*> chunks;
+
+    /// @brief Head of the list of released slots.
+    slot_type* free_head = nullptr;
+
+    /// @brief Next slot of the newest chunk which was never acquired.
+    slot_type* fresh = nullptr;
+
+    /// @brief End of the newest chunk.
+    slot_type* fresh_end = nullptr;
+};
+
+} // namespace MAYBE_UNINIT_NAMESPACE
@@ -0,0 +1,426 @@
+/// @file
+/// @brief Defines the template type `small_vector`, a vector storing up to a fixed number of elements inline in
+/// `maybe_uninit` slots before spilling to the heap.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <algorithm>
+#include <array>
+#include <concepts>
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+/// @brief Vector storing up to @p N elements inline, which only allocates dynamic memory once it grows past @p N
+/// elements.
+/// @details The inline buffer is an array of `maybe_uninit<T>` slots, so no element is constructed before it's
+/// inserted. Once spilled, elements live in a heap buffer of `maybe_uninit<T>` slots obtained from
+/// `std::allocator<maybe_uninit<T>>`, which grows geometrically. Trivially relocatable elements are relocated to the
+/// new buffer with a single `memcpy`:
+/// @code {.cpp}
+///     auto headers = small_vector<Header, 16>{}; // no Header is constructed, nothing is allocated.
+///     headers.emplace_back(name, value);         // stored inline.
+///     headers.reserve(64);                       // spills to the heap.
+/// @endcode
+/// @tparam T Type of the elements.
+/// @tparam N Number of elements stored inline.
+template <detail::sized T, std::size_t N>
+    requires(N > 0)
+class small_vector {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = T const&;
+    using pointer = T*;
+    using const_pointer = T const*;
+    using iterator = T*;
+    using const_iterator = T const*;
+
+    /// @brief Default constructor. Constructs an empty vector, performing no initialization on the inline slots.
+    constexpr small_vector() noexcept = default;
+
+    /// @brief Copy constructor. Copy constructs the elements of @p other, spilling to the heap if they don't fit
+    /// inline.
+    /// @note Propagates exceptions thrown by `T`'s copy constructor or by the allocator, after releasing everything
+    /// acquired so far.
+    constexpr small_vector(small_vector const& other)
+        requires std::copy_constructible<T>
+    {
+        this->construct_from(other.begin(), other.end());
+    }
+
+    /// @brief Move constructor. Steals @p other's heap buffer if it spilled, and move constructs its elements
+    /// otherwise.
+    /// @note If @p other didn't spill, it keeps its size and its elements are left in a moved-from state. Otherwise, it
+    /// is left empty.
+    constexpr small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>)
+        requires std::move_constructible<T>
+    {
+        this->move_from(std::move(other));
+    }
+
+    /// @brief Copy assignment operator. Copy assigns the common prefix, then constructs or destroys the remainder.
+    constexpr auto operator=(small_vector const& other) -> small_vector&
+        requires std::copyable<T>
+    {
+        if (this != std::addressof(other)) {
+            this->reserve(other.count);
+            auto const common = std::min(this->count, other.count);
+            std::copy_n(other.begin(), common, this->begin());
+            for (auto const& value : std::span(other.begin() + common, other.end())) {
+                this->emplace_back(value);
+            }
+            this->destroy_from(other.count);
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment operator. Releases the current elements, then behaves like the move constructor.
+    constexpr auto operator=(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) -> small_vector&
+        requires std::move_constructible<T>
+    {
+        if (this != std::addressof(other)) {
+            this->reset();
+            this->move_from(std::move(other));
+        }
+        return *this;
+    }
+
+    /// @brief Destructor. Destroys every element and releases the heap buffer, if any.
+    constexpr ~small_vector() {
+        this->reset();
+    }
+
+    /// @brief Returns the number of elements.
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return this->count;
+    }
+
+    /// @brief Returns the number of elements that fit in the current buffer.
+    [[nodiscard]]
+    constexpr auto capacity() const noexcept -> size_type {
+        return this->cap;
+    }
+
+    /// @brief Returns the number of elements stored inline, i.e. @p N.
+    [[nodiscard]]
+    static constexpr auto inline_capacity() noexcept -> size_type {
+        return N;
+    }
+
+    /// @brief Returns whether the vector holds no elements.
+    [[nodiscard]]
+    constexpr auto empty() const noexcept -> bool {
+        return this->count == 0;
+    }
+
+    /// @brief Returns whether the elements are stored inline, i.e. whether the vector hasn't spilled to the heap.
+    [[nodiscard]]
+    constexpr auto is_inline() const noexcept -> bool {
+        return this->slots == this->inline_slots.data();
+    }
+
+    /// @brief Returns a pointer to the storage of the first element, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto data(this Self&& self) noexcept -> auto* {
+        using slot_type = std::conditional_t<
+            std::is_const_v<std::remove_reference_t<Self>>,
+            maybe_uninit<T> const,
+            maybe_uninit<T>>;
+        return static_cast<slot_type*>(self.slots)->ptr();
+    }
+
+    /// @brief Returns an iterator to the first element, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto begin(this Self&& self) noexcept -> auto* {
+        return std::forward<Self>(self).data();
+    }
+
+    /// @brief Returns an iterator past the last element, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto end(this Self&& self) noexcept -> auto* {
+        return std::forward<Self>(self).data() + self.count;
+    }
+
+    /// @brief Returns a reference to the element at @p index, preserving the constness of @p self.
+    /// @pre `index < size()`.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto operator[](this Self&& self, size_type const index) noexcept -> auto& {
+        return std::forward<Self>(self).data()[index];
+    }
+
+    /// @brief Returns a reference to the first element, preserving the constness of @p self.
+    /// @pre `not empty()`.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto front(this Self&& self) noexcept -> auto& {
+        return *std::forward<Self>(self).data();
+    }
+
+    /// @brief Returns a reference to the last element, preserving the constness of @p self.
+    /// @pre `not empty()`.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto back(this Self&& self) noexcept -> auto& {
+        return std::forward<Self>(self).data()[self.count - 1];
+    }
+
+    /// @brief Returns a span over the elements, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto span(this Self&& self) noexcept -> std::ranges::borrowed_range auto {
+        return std::span(std::forward<Self>(self).data(), self.count);
+    }
+
+    /// @brief Ensures the buffer can hold at least @p new_cap elements, spilling to the heap if needed.
+    /// @note Propagates exceptions thrown by the allocator or by `T`'s move constructor, in which case the vector is
+    /// left unchanged.
+    constexpr auto reserve(size_type const new_cap) {
+        if (new_cap > this->cap) {
+            auto* const new_slots = allocator_type().allocate(new_cap);
+            try {
+                this->relocate_to(new_slots, new_cap);
+            } catch (...) {
+                allocator_type().deallocate(new_slots, new_cap);
+                throw;
+            }
+        }
+    }
+
+    /// @brief Constructs an element at the end as if by `T(std::forward<Args>(args)...)`, spilling to the heap if the
+    /// buffer is full.
+    /// @returns A reference to the constructed element.
+    /// @note @p args may refer to elements of the vector.
+    /// @note Propagates exceptions thrown by `T`'s selected constructor or by the allocator, in which case the vector
+    /// is left unchanged.
+    template <typename... Args>
+    constexpr auto emplace_back(Args&&... args) -> T&
+        requires detail::paren_constructible_from<T, Args...>
+    {
+        if (this->count == this->cap) {
+            return this->grow_and_emplace_back(std::forward<Args>(args)...);
+        }
+        auto& object = this->slots[this->count].paren_init(std::forward<Args>(args)...);
+        ++this->count;
+        return object;
+    }
+
+    /// @brief Copy constructs @p value at the end.
+    constexpr auto push_back(T const& value) -> T&
+        requires std::is_copy_constructible_v<T>
+    {
+        return this->emplace_back(value);
+    }
+
+    /// @brief Move constructs @p value at the end.
+    constexpr auto push_back(T&& value) -> T&
+        requires std::is_move_constructible_v<T>
+    {
+        return this->emplace_back(std::move(value));
+    }
+
+    /// @brief Destroys the last element.
+    /// @pre `not empty()`.
+    constexpr auto pop_back() noexcept(std::is_nothrow_destructible_v<T>) {
+        --this->count;
+        this->slots[this->count].destroy();
+    }
+
+    /// @brief Constructs an element before @p pos as if by `T(std::forward<Args>(args)...)`.
+    /// @details The element is constructed at the end and then rotated into place.
+    /// @returns An iterator to the constructed element.
+    template <typename... Args>
+    constexpr auto emplace(const_iterator const pos, Args&&... args) -> iterator
+        requires detail::paren_constructible_from<T, Args...> and std::is_move_constructible_v<T>
+                 and std::is_move_assignable_v<T>
+    {
+        auto const offset = pos - this->begin();
+        this->emplace_back(std::forward<Args>(args)...);
+        auto const first = this->begin() + offset;
+        std::rotate(first, this->end() - 1, this->end());
+        return first;
+    }
+
+    /// @brief Copy constructs @p value before @p pos.
+    constexpr auto insert(const_iterator const pos, T const& value) -> iterator
+        requires std::is_copy_constructible_v<T>
+    {
+        return this->emplace(pos, value);
+    }
+
+    /// @brief Move constructs @p value before @p pos.
+    constexpr auto insert(const_iterator const pos, T&& value) -> iterator
+        requires std::is_move_constructible_v<T>
+    {
+        return this->emplace(pos, std::move(value));
+    }
+
+    /// @brief Erases the elements in `[first, last)`, shifting the following elements left.
+    /// @returns An iterator to the element following the last erased one.
+    constexpr auto erase(const_iterator const first, const_iterator const last) -> iterator
+        requires std::is_move_assignable_v<T>
+    {
+        auto const begin = this->begin() + (first - this->begin());
+        auto const new_end = std::move(begin + (last - first), this->end(), begin);
+        this->destroy_from(static_cast<size_type>(new_end - this->begin()));
+        return begin;
+    }
+
+    /// @brief Erases the element at @p pos, shifting the following elements left.
+    /// @returns An iterator to the element following the erased one.
+    /// @pre @p pos is dereferenceable.
+    constexpr auto erase(const_iterator const pos) -> iterator
+        requires std::is_move_assignable_v<T>
+    {
+        return this->erase(pos, pos + 1);
+    }
+
+    /// @brief Destroys every element. The capacity is left unchanged.
+    constexpr auto clear() noexcept(std::is_nothrow_destructible_v<T>) {
+        this->destroy_from(0);
+    }
+
+  private:
+    using allocator_type = std::allocator<maybe_uninit<T>>;
+
+    /// @brief Returns the capacity to grow to in order to hold at least @p required elements.
+    [[nodiscard]]
+    constexpr auto next_capacity(size_type const required) const noexcept -> size_type {
+        return std::max(this->cap * 2, required);
+    }
+
+    /// @brief Constructs a new element at the end of a larger heap buffer, then relocates the current elements to it.
+    /// @details The new element is constructed first, as @p args may refer to elements of the vector.
+    template <typename... Args>
+    constexpr auto grow_and_emplace_back(Args&&... args) -> T& {
+        auto const new_cap = this->next_capacity(this->count + 1);
+        auto* const new_slots = allocator_type().allocate(new_cap);
+        auto& new_slot = new_slots[this->count];
+        try {
+            new_slot.paren_init(std::forward<Args>(args)...);
+        } catch (...) {
+            allocator_type().deallocate(new_slots, new_cap);
+            throw;
+        }
+        try {
+            this->relocate_to(new_slots, new_cap);
+        } catch (...) {
+            new_slot.destroy();
+            allocator_type().deallocate(new_slots, new_cap);
+            throw;
+        }
+        ++this->count;
+        return new_slot.ref();
+    }
+
+    /// @brief Relocates the elements to @p new_slots, a heap buffer of @p new_cap slots, and adopts it.
+    /// @details Elements are relocated with `relocate_all()` when that can't throw, which is a single `memcpy` for
+    /// trivially relocatable `T`s. Otherwise, they're copied and the originals are destroyed.
+    /// @note Propagates exceptions thrown by `T`'s copy constructor, after destroying the copies. The vector is then
+    /// left unchanged, and @p new_slots, which the caller still owns, must be deallocated by the caller.
+    constexpr auto relocate_to(maybe_uninit<T>* const new_slots, size_type const new_cap) {
+        if constexpr (detail::nothrow_relocatable<T>) {
+            relocate_all(std::span(this->slots, this->count), std::span(new_slots, this->count));
+        } else {
+            auto moved = size_type{0};
+            try {
+                for (; moved != this->count; ++moved) {
+                    new_slots[moved].paren_init(std::move_if_noexcept(this->slots[moved].ref()));
+                }
+            } catch (...) {
+                while (moved != 0) {
+                    new_slots[--moved].destroy();
+                }
+                throw;
+            }
+            for (auto i = size_type{0}; i != this->count; ++i) {
+                this->slots[i].destroy();
+            }
+        }
+        this->adopt(new_slots, new_cap);
+    }
+
+    /// @brief Makes @p new_slots, whose first `count` slots hold the elements, the current buffer, releasing the
+    /// previous heap buffer, if any.
+    constexpr auto adopt(maybe_uninit<T>* const new_slots, size_type const new_cap) noexcept {
+        if (not this->is_inline()) {
+            allocator_type().deallocate(this->slots, this->cap);
+        }
+        this->slots = new_slots;
+        this->cap = new_cap;
+    }
+
+    /// @brief Constructs the elements from `[first, last)`, assuming the vector is empty.
+    /// @note Propagates exceptions thrown by `T`'s selected constructor or by the allocator, after releasing
+    /// everything acquired so far.
+    template <typename It>
+    constexpr auto construct_from(It first, It const last) {
+        try {
+            this->reserve(static_cast<size_type>(std::distance(first, last)));
+            for (; first != last; ++first) {
+                this->emplace_back(*first);
+            }
+        } catch (...) {
+            this->reset();
+            throw;
+        }
+    }
+
+    /// @brief Takes over the elements of @p other, assuming the vector is empty and inline.
+    constexpr auto move_from(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<T>) {
+        if (other.is_inline()) {
+            this->construct_from(std::make_move_iterator(other.begin()), std::make_move_iterator(other.end()));
+        } else {
+            this->slots = std::exchange(other.slots, other.inline_slots.data());
+            this->cap = std::exchange(other.cap, N);
+            this->count = std::exchange(other.count, 0);
+        }
+    }
+
+    /// @brief Destroys the elements starting at @p new_count, in reverse order.
+    constexpr auto destroy_from(size_type const new_count) noexcept(std::is_nothrow_destructible_v<T>) {
+        if constexpr (std::is_trivially_destructible_v<T>) {
+            this->count = std::min(this->count, new_count);
+        } else {
+            while (this->count > new_count) {
+                this->pop_back();
+            }
+        }
+    }
+
+    /// @brief Destroys every element and releases the heap buffer, if any, making the vector inline again.
+    constexpr auto reset() noexcept(std::is_nothrow_destructible_v<T>) {
+        this->clear();
+        this->adopt(this->inline_slots.data(), N);
+    }
+
+    /// @brief The inline slots, used until the vector spills to the heap.
+    std::array<maybe_uninit<T>, N> inline_slots{};
+
+    /// @brief The current buffer, either `inline_slots.data()` or a heap buffer of `cap` slots. Its first `count`
+    /// slots are constructed.
+    maybe_uninit<T>* slots = this->inline_slots.data();
+
+    /// @brief Number of slots in the current buffer.
+    size_type cap = N;
+
+    /// @brief Number of constructed elements.
+    size_type count = 0;
+};
+
+} // namespace MAYBE_UNINIT_NAMESPACE
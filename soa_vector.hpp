@@ -0,0 +1,330 @@
+/// @file
+/// @brief Defines the template type `soa_vector`, a structure-of-arrays vector storing each field of its elements in a
+/// separate column of `maybe_uninit` slots.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+/// @brief Vector of elements made of the fields `Fields...`, stored as a structure of arrays: each field lives in its
+/// own contiguous column, so that scans touching a few fields only load those.
+/// @details Each column is a heap buffer of `maybe_uninit<Field>` slots obtained from `std::allocator`, so no field is
+/// constructed before its element is inserted. Elements are constructed field by field, each in its column, and are
+/// accessed through proxy references, which are tuples of references to their fields. Columns are exposed as spans,
+/// which can be handed to vectorized kernels:
+/// @code {.cpp}
+///     auto trades = soa_vector<std::uint64_t, double, std::uint32_t>{}; // id, price, quantity.
+///     trades.emplace_back(id, price, quantity);
+///
+///     auto [trade_id, trade_price, trade_quantity] = trades[0];         // references to the fields.
+///     trade_price *= 1.01;
+///
+///     std::span<double> prices = trades.column<1>();                    // contiguous doubles.
+///     auto const total = std::reduce(prices.begin(), prices.end());
+/// @endcode
+/// Columns grow together, geometrically, and fields are relocated to the new columns with `relocate_all()`, which is a
+/// single `memcpy` per column for trivially relocatable fields.
+/// @tparam Fields Types of the fields. Must be nothrow relocatable, so that growing can't throw once the new columns
+/// are allocated.
+template <detail::sized... Fields>
+    requires(sizeof...(Fields) != 0 and (detail::nothrow_relocatable<Fields> and ...))
+class soa_vector {
+  public:
+    using value_type = std::tuple<Fields...>;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = std::tuple<Fields&...>;
+    using const_reference = std::tuple<Fields const&...>;
+
+    /// @brief Type of the field at index `I`.
+    template <std::size_t I>
+    using field_type = std::tuple_element_t<I, value_type>;
+
+    /// @brief Default constructor. Constructs an empty vector, without allocating.
+    constexpr soa_vector() noexcept = default;
+
+    /// @brief Copy constructor. Copy constructs the fields of @p other column by column, with a single `memcpy` per
+    /// column of trivially copyable fields.
+    /// @note Propagates exceptions thrown by the fields' copy constructors or by the allocator, after releasing
+    /// everything acquired so far.
+    constexpr soa_vector(soa_vector const& other)
+        requires(std::copy_constructible<Fields> and ...)
+    {
+        this->reserve(other.count);
+        auto copied = std::size_t{0};
+        try {
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                ((init_from_range(std::span(std::get<I>(this->columns), other.count), other.template column<I>()),
+                  ++copied),
+                 ...);
+            }(indices{});
+        } catch (...) {
+            [&]<std::size_t... I>(std::index_sequence<I...>) {
+                ([&] {
+                    if (I < copied) {
+                        destroy_all(std::span(std::get<I>(this->columns), other.count));
+                    }
+                }(),
+                 ...);
+            }(indices{});
+            deallocate(this->columns, this->cap);
+            throw;
+        }
+        this->count = other.count;
+    }
+
+    /// @brief Move constructor. Steals the columns of @p other, leaving it empty.
+    constexpr soa_vector(soa_vector&& other) noexcept
+        : columns(std::exchange(other.columns, columns_type{}))
+        , cap(std::exchange(other.cap, 0))
+        , count(std::exchange(other.count, 0)) {}
+
+    /// @brief Copy assignment operator. Copy constructs the fields of @p other into new columns, which then replace
+    /// the current ones.
+    /// @note Propagates exceptions thrown by the fields' copy constructors or by the allocator, in which case the
+    /// vector is left unchanged.
+    constexpr auto operator=(soa_vector const& other) -> soa_vector&
+        requires(std::copy_constructible<Fields> and ...)
+    {
+        if (this != std::addressof(other)) {
+            *this = soa_vector(other);
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment operator. Releases the current elements, then steals the columns of @p other, leaving it
+    /// empty.
+    constexpr auto operator=(soa_vector&& other) noexcept -> soa_vector& {
+        if (this != std::addressof(other)) {
+            this->reset();
+            this->columns = std::exchange(other.columns, columns_type{});
+            this->cap = std::exchange(other.cap, 0);
+            this->count = std::exchange(other.count, 0);
+        }
+        return *this;
+    }
+
+    /// @brief Destructor. Destroys every element and releases the columns.
+    constexpr ~soa_vector() {
+        this->reset();
+    }
+
+    /// @brief Returns the number of elements.
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return this->count;
+    }
+
+    /// @brief Returns the number of slots in each column.
+    [[nodiscard]]
+    constexpr auto capacity() const noexcept -> size_type {
+        return this->cap;
+    }
+
+    /// @brief Returns whether the vector holds no elements.
+    [[nodiscard]]
+    constexpr auto empty() const noexcept -> bool {
+        return this->count == 0;
+    }
+
+    /// @brief Returns a span over the field at index `I` of every element, preserving the constness of @p self.
+    template <std::size_t I, typename Self>
+    [[nodiscard]]
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto column(this Self&& self) noexcept -> std::ranges::borrowed_range auto
+        requires(I < sizeof...(Fields))
+    {
+        using object_type = std::conditional_t<detail::const_ref<Self>, field_type<I> const, field_type<I>>;
+        // maybe_uninit<T> and T are pointer-interconvertible.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return std::span(reinterpret_cast<object_type*>(std::get<I>(self.columns)), self.count);
+    }
+
+    /// @brief Returns a proxy reference to the element at @p index, i.e. a tuple of references to its fields,
+    /// preserving the constness of @p self.
+    /// @pre `index < size()`.
+    template <typename Self>
+    [[nodiscard]]
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto operator[](this Self&& self, size_type const index) noexcept {
+        using result_type = std::conditional_t<detail::const_ref<Self>, const_reference, reference>;
+        return std::apply([index](auto* const... slots) { return result_type(slots[index].ref()...); }, self.columns);
+    }
+
+    /// @brief Ensures each column can hold at least @p new_cap fields.
+    /// @note Propagates exceptions thrown by the allocator, in which case the vector is left unchanged.
+    constexpr auto reserve(size_type const new_cap) {
+        if (new_cap > this->cap) {
+            this->adopt(allocate(new_cap), new_cap);
+        }
+    }
+
+    /// @brief Constructs an element at the end, each field being constructed as if by `Field(std::forward<Arg>(arg))`
+    /// from the argument at the same index, growing the columns if they're full.
+    /// @returns A proxy reference to the constructed element.
+    /// @note @p args may refer to fields of the vector.
+    /// @note Propagates exceptions thrown by the fields' selected constructors or by the allocator, in which case the
+    /// vector is left unchanged.
+    template <typename... Args>
+    constexpr auto emplace_back(Args&&... args) -> reference
+        requires(sizeof...(Args) == sizeof...(Fields) and (detail::paren_constructible_from<Fields, Args> and ...))
+    {
+        if (this->count != this->cap) {
+            construct_row(this->columns, this->count, indices{}, std::forward<Args>(args)...);
+        } else {
+            // Constructs the new element before relocating the others, as args may refer to them.
+            auto const new_cap = std::max(this->cap * 2, this->count + 1);
+            auto const new_columns = allocate(new_cap);
+            try {
+                construct_row(new_columns, this->count, indices{}, std::forward<Args>(args)...);
+            } catch (...) {
+                deallocate(new_columns, new_cap);
+                throw;
+            }
+            this->adopt(new_columns, new_cap);
+        }
+        ++this->count;
+        return (*this)[this->count - 1];
+    }
+
+    /// @brief Copy constructs each field of @p value at the end.
+    constexpr auto push_back(value_type const& value) -> reference
+        requires(std::is_copy_constructible_v<Fields> and ...)
+    {
+        return std::apply([this](Fields const&... fields) { return this->emplace_back(fields...); }, value);
+    }
+
+    /// @brief Move constructs each field of @p value at the end.
+    constexpr auto push_back(value_type&& value) -> reference
+        requires(std::is_move_constructible_v<Fields> and ...)
+    {
+        return std::apply([this](Fields&... fields) { return this->emplace_back(std::move(fields)...); }, value);
+    }
+
+    /// @brief Destroys the last element.
+    /// @pre `not empty()`.
+    constexpr auto pop_back() noexcept((std::is_nothrow_destructible_v<Fields> and ...)) {
+        this->destroy_from(this->count - 1);
+    }
+
+    /// @brief Destroys every element. The capacity is left unchanged.
+    constexpr auto clear() noexcept((std::is_nothrow_destructible_v<Fields> and ...)) {
+        this->destroy_from(0);
+    }
+
+  private:
+    using columns_type = std::tuple<maybe_uninit<Fields>*...>;
+    using indices = std::index_sequence_for<Fields...>;
+
+    /// @brief Allocates columns of @p n slots each.
+    /// @note Propagates exceptions thrown by the allocator, after releasing the columns allocated so far.
+    static constexpr auto allocate(size_type const n) -> columns_type {
+        auto result = columns_type{};
+        try {
+            std::apply(
+                [n]<typename... Slots>(Slots*&... slots) { ((slots = std::allocator<Slots>().allocate(n)), ...); },
+                result
+            );
+        } catch (...) {
+            deallocate(result, n);
+            throw;
+        }
+        return result;
+    }
+
+    /// @brief Releases @p columns, columns of @p n slots each, skipping null ones.
+    static constexpr auto deallocate(columns_type const& columns, size_type const n) noexcept {
+        std::apply(
+            [n]<typename... Slots>(Slots* const... slots) {
+                ([&] {
+                    if (slots != nullptr) {
+                        std::allocator<Slots>().deallocate(slots, n);
+                    }
+                }(),
+                 ...);
+            },
+            columns
+        );
+    }
+
+    /// @brief Constructs the fields of row @p row of @p columns from @p args, field by field. If a constructor throws,
+    /// destroys the fields constructed so far.
+    template <std::size_t... I, typename... Args>
+    static constexpr auto construct_row(
+        columns_type const& columns,
+        size_type const row,
+        std::index_sequence<I...>,
+        Args&&... args
+    ) noexcept((detail::nothrow_paren_constructible_from<Fields, Args> and ...)) {
+        if constexpr ((detail::nothrow_paren_constructible_from<Fields, Args> and ...)) {
+            (std::get<I>(columns)[row].paren_init(std::forward<Args>(args)), ...);
+        } else {
+            auto constructed = std::size_t{0};
+            try {
+                ((std::get<I>(columns)[row].paren_init(std::forward<Args>(args)), ++constructed), ...);
+            } catch (...) {
+                ([&] {
+                    if (I < constructed) {
+                        std::get<I>(columns)[row].destroy();
+                    }
+                }(),
+                 ...);
+                throw;
+            }
+        }
+    }
+
+    /// @brief Relocates the elements to @p new_columns, columns of @p new_cap slots each, and releases the current
+    /// columns.
+    constexpr auto adopt(columns_type const& new_columns, size_type const new_cap) noexcept {
+        [&]<std::size_t... I>(std::index_sequence<I...>) {
+            (relocate_all(
+                 std::span(std::get<I>(this->columns), this->count),
+                 std::span(std::get<I>(new_columns), this->count)
+             ),
+             ...);
+        }(indices{});
+        deallocate(this->columns, this->cap);
+        this->columns = new_columns;
+        this->cap = new_cap;
+    }
+
+    /// @brief Destroys the elements starting at @p new_count, column by column.
+    constexpr auto destroy_from(size_type const new_count) noexcept((std::is_nothrow_destructible_v<Fields> and ...)) {
+        std::apply(
+            [&](auto* const... slots) { (destroy_all(std::span(slots + new_count, this->count - new_count)), ...); },
+            this->columns
+        );
+        this->count = new_count;
+    }
+
+    /// @brief Destroys every element and releases the columns.
+    constexpr auto reset() noexcept((std::is_nothrow_destructible_v<Fields> and ...)) {
+        this->clear();
+        deallocate(this->columns, this->cap);
+        this->columns = columns_type{};
+        this->cap = 0;
+    }
+
+    /// @brief The columns, whose first `count` slots are constructed, or null pointers if nothing was allocated.
+    columns_type columns{};
+
+    /// @brief Number of slots in each column.
+    size_type cap = 0;
+
+    /// @brief Number of constructed elements.
+    size_type count = 0;
+};
+
+} // namespace MAYBE_UNINIT_NAMESPACE
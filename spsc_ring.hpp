@@ -0,0 +1,195 @@
+/// @file
+/// @brief Defines the template type `spsc_ring`, a lock-free single-producer single-consumer ring buffer whose slots
+/// are `maybe_uninit` objects.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+/// @brief Lock-free, bounded, single-producer single-consumer queue of up to @p N elements.
+/// @details Slots are `maybe_uninit<T>` objects, so `T` needn't be default constructible: elements are constructed in
+/// place when pushed, and relocated out when popped. The consumer's and the producer's indices live on separate cache
+/// lines, each next to a cached copy of the other side's index, so that neither side touches the other's line unless
+/// the ring looks full or empty:
+/// @code {.cpp}
+///     auto ring = spsc_ring<Message, 1024>{};
+///
+///     // Producer thread.
+///     while (not ring.try_emplace(header, std::move(payload))) {}
+///
+///     // Consumer thread.
+///     while (std::optional<Message> message = ring.try_pop()) {
+///         parse(*message);
+///     }
+/// @endcode
+/// @tparam T Type of the elements.
+/// @tparam N Maximum number of elements.
+/// @attention At most one thread may call the producer functions (`try_emplace()` and `try_push_from()`) and at most
+/// one thread may call the consumer functions (`try_pop()` and `try_pop_into()`) at any given time.
+template <detail::sized T, std::size_t N>
+    requires(N > 0)
+class spsc_ring {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /// @brief Default constructor. Constructs an empty ring, performing no initialization on the slots.
+    spsc_ring() noexcept = default;
+
+    spsc_ring(spsc_ring const&) = delete;
+    spsc_ring(spsc_ring&&) = delete;
+    auto operator=(spsc_ring const&) -> spsc_ring& = delete;
+    auto operator=(spsc_ring&&) -> spsc_ring& = delete;
+
+    /// @brief Destructor. Destroys the elements which were pushed but not popped.
+    /// @pre Neither the producer nor the consumer are accessing the ring.
+    ~spsc_ring() {
+        auto const tail = this->tail.load(std::memory_order_relaxed);
+        for (auto i = this->head.load(std::memory_order_relaxed); i != tail; ++i) {
+            this->slots[i % N].destroy();
+        }
+    }
+
+    /// @brief Returns the maximum number of elements, i.e. @p N.
+    [[nodiscard]]
+    static constexpr auto capacity() noexcept -> size_type {
+        return N;
+    }
+
+    /// @brief Producer function. Constructs an element at the back as if by `T(std::forward<Args>(args)...)`, if the
+    /// ring isn't full.
+    /// @returns Whether the element was pushed.
+    /// @note Propagates exceptions thrown by `T`'s selected constructor, in which case nothing is pushed.
+    template <typename... Args>
+    auto try_emplace(Args&&... args) noexcept(detail::nothrow_paren_constructible_from<T, Args...>) -> bool
+        requires detail::paren_constructible_from<T, Args...>
+    {
+        auto const tail = this->tail.load(std::memory_order_relaxed);
+        if (this->free_slots(tail, 1) == 0) {
+            return false;
+        }
+        this->slots[tail % N].paren_init(std::forward<Args>(args)...);
+        this->tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Producer function. Relocates as many objects from the leading slots of @p source to the back as fit.
+    /// @details Objects are relocated with at most two calls to `relocate_all()`, which are single `memcpy`s for
+    /// trivially relocatable `T`s.
+    /// @returns The number of objects pushed, whose slots in @p source no longer hold objects.
+    template <detail::slot_range R>
+    auto try_push_from(R&& source) noexcept -> size_type
+        requires std::is_same_v<detail::slot_value_t<R>, T> and detail::nothrow_relocatable<T>
+    {
+        auto const tail = this->tail.load(std::memory_order_relaxed);
+        auto const from = std::span(source);
+        auto const n = this->free_slots(tail, from.size());
+        auto const start = tail % N;
+        auto const first = std::min(n, N - start);
+        relocate_all(from.first(first), std::span(this->slots).subspan(start, first));
+        relocate_all(from.subspan(first, n - first), std::span(this->slots).first(n - first));
+        this->tail.store(tail + n, std::memory_order_release);
+        return n;
+    }
+
+    /// @brief Consumer function. Relocates the front element into @p dst, if the ring isn't empty.
+    /// @returns Whether an element was popped.
+    /// @attention @p dst is assumed not to hold an object.
+    auto try_pop(maybe_uninit<T>& dst) noexcept(detail::nothrow_relocatable<T>) -> bool
+        requires detail::relocatable<T>
+    {
+        auto const head = this->head.load(std::memory_order_relaxed);
+        if (this->used_slots(head, 1) == 0) {
+            return false;
+        }
+        this->slots[head % N].relocate_into(dst);
+        this->head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /// @brief Consumer function. Moves the front element out, if the ring isn't empty.
+    /// @returns The popped element, or `std::nullopt` if the ring is empty.
+    /// @note Propagates exceptions thrown by `T`'s move constructor, in which case nothing is popped.
+    [[nodiscard]]
+    auto try_pop() noexcept(std::is_nothrow_move_constructible_v<T>) -> std::optional<T>
+        requires std::is_move_constructible_v<T>
+    {
+        auto const head = this->head.load(std::memory_order_relaxed);
+        if (this->used_slots(head, 1) == 0) {
+            return std::nullopt;
+        }
+        auto& slot = this->slots[head % N];
+        auto result = std::optional<T>(std::in_place, std::move(slot.ref()));
+        slot.destroy();
+        this->head.store(head + 1, std::memory_order_release);
+        return result;
+    }
+
+    /// @brief Consumer function. Relocates as many elements from the front into the leading slots of @p destination as
+    /// fit.
+    /// @details Elements are relocated with at most two calls to `relocate_all()`, which are single `memcpy`s for
+    /// trivially relocatable `T`s.
+    /// @returns The number of elements popped, which now live in the leading slots of @p destination.
+    /// @attention The slots of @p destination are assumed not to hold objects.
+    template <detail::slot_range R>
+    auto try_pop_into(R&& destination) noexcept -> size_type
+        requires std::is_same_v<detail::slot_value_t<R>, T> and detail::nothrow_relocatable<T>
+    {
+        auto const head = this->head.load(std::memory_order_relaxed);
+        auto const to = std::span(destination);
+        auto const n = this->used_slots(head, to.size());
+        auto const start = head % N;
+        auto const first = std::min(n, N - start);
+        relocate_all(std::span(this->slots).subspan(start, first), to.first(first));
+        relocate_all(std::span(this->slots).first(n - first), to.subspan(first, n - first));
+        this->head.store(head + n, std::memory_order_release);
+        return n;
+    }
+
+  private:
+    /// @brief Producer function. Returns how many of the @p wanted next slots are free, refreshing the cached head
+    /// only if the cached value doesn't allow for all of them.
+    auto free_slots(size_type const tail, size_type const wanted) noexcept -> size_type {
+        if (N - (tail - this->cached_head) < wanted) {
+            this->cached_head = this->head.load(std::memory_order_acquire);
+        }
+        return std::min(wanted, N - (tail - this->cached_head));
+    }
+
+    /// @brief Consumer function. Returns how many of the @p wanted next slots hold elements, refreshing the cached tail
+    /// only if the cached value doesn't allow for all of them.
+    auto used_slots(size_type const head, size_type const wanted) noexcept -> size_type {
+        if (this->cached_tail - head < wanted) {
+            this->cached_tail = this->tail.load(std::memory_order_acquire);
+        }
+        return std::min(wanted, this->cached_tail - head);
+    }
+
+    /// @brief Number of elements popped so far. Written by the consumer.
+    alignas(detail::cache_line_size) std::atomic<size_type> head = 0;
+
+    /// @brief The consumer's copy of `tail`.
+    size_type cached_tail = 0;
+
+    /// @brief Number of elements pushed so far. Written by the producer.
+    alignas(detail::cache_line_size) std::atomic<size_type> tail = 0;
+
+    /// @brief The producer's copy of `head`.
+    size_type cached_head = 0;
+
+    /// @brief The element slots, of which those in `[head, tail)`, modulo @p N, are constructed.
+    alignas(detail::cache_line_size) std::array<maybe_uninit<T>, N> slots{};
+};
+
+} // namespace MAYBE_UNINIT_NAMESPACE
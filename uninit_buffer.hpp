@@ -0,0 +1,145 @@
+/// @file
+/// @brief Defines the template type `uninit_buffer`, an owning heap array of `maybe_uninit` slots.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <span>
+#include <type_traits>
+#include <utility>
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+/// @brief Owning heap array of `maybe_uninit<T>` slots, akin to `std::make_unique_for_overwrite<T[]>(n)` with
+/// per-element lifetime control.
+/// @details No object is constructed, so allocating a buffer costs a single allocation no matter its size. The buffer
+/// is a contiguous range of slots, so it can be passed to the bulk functions directly:
+/// @code {.cpp}
+///     auto pixels = uninit_buffer<Pixel>(width * height); // nothing is zeroed.
+///     std::span<Pixel> decoded = init_n_with(pixels, pixels.size(), decoder);
+///     // ...
+///     destroy_all(pixels);
+/// @endcode
+/// The slots are allocated by `std::allocator<maybe_uninit<T>>`, which honors the alignment of over-aligned `T`s.
+/// @tparam T Type of the objects.
+/// @attention Like `maybe_uninit`, `uninit_buffer` doesn't destroy the objects it holds. It's up to the caller to
+/// ensure they're destroyed before the buffer is.
+template <detail::sized T>
+class uninit_buffer {
+  public:
+    using value_type = maybe_uninit<T>;
+    using size_type = std::size_t;
+    using iterator = maybe_uninit<T>*;
+    using const_iterator = maybe_uninit<T> const*;
+
+    /// @brief Default constructor. Constructs an empty buffer, without allocating.
+    constexpr uninit_buffer() noexcept = default;
+
+    /// @brief Allocates @p n slots, performing no initialization on them.
+    /// @note Propagates exceptions thrown by the allocator.
+    explicit constexpr uninit_buffer(size_type const n)
+        : first(allocator_type().allocate(n))
+        , count(n) {
+        std::uninitialized_default_construct_n(this->first, n);
+    }
+
+    constexpr uninit_buffer(uninit_buffer const&) = delete;
+
+    /// @brief Move constructor. Takes over the slots of @p other, leaving it empty.
+    constexpr uninit_buffer(uninit_buffer&& other) noexcept
+        : first(std::exchange(other.first, nullptr))
+        , count(std::exchange(other.count, 0)) {}
+
+    constexpr auto operator=(uninit_buffer const&) -> uninit_buffer& = delete;
+
+    /// @brief Move assignment operator. Releases the current slots and takes over the slots of @p other, leaving it
+    /// empty.
+    constexpr auto operator=(uninit_buffer&& other) noexcept -> uninit_buffer& {
+        if (this != std::addressof(other)) {
+            this->release();
+            this->first = std::exchange(other.first, nullptr);
+            this->count = std::exchange(other.count, 0);
+        }
+        return *this;
+    }
+
+    /// @brief Destructor. Releases the slots without destroying the objects they may hold.
+    constexpr ~uninit_buffer() {
+        this->release();
+    }
+
+    /// @brief Returns the number of slots.
+    [[nodiscard]]
+    constexpr auto size() const noexcept -> size_type {
+        return this->count;
+    }
+
+    /// @brief Returns whether the buffer holds no slots.
+    [[nodiscard]]
+    constexpr auto empty() const noexcept -> bool {
+        return this->count == 0;
+    }
+
+    /// @brief Returns a pointer to the first slot, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    constexpr auto data(this Self&& self) noexcept -> auto* {
+        using slot_type = std::conditional_t<
+            std::is_const_v<std::remove_reference_t<Self>>,
+            maybe_uninit<T> const,
+            maybe_uninit<T>>;
+        return static_cast<slot_type*>(self.first);
+    }
+
+    /// @brief Returns an iterator to the first slot, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto begin(this Self&& self) noexcept -> auto* {
+        return std::forward<Self>(self).data();
+    }
+
+    /// @brief Returns an iterator past the last slot, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto end(this Self&& self) noexcept -> auto* {
+        return std::forward<Self>(self).data() + self.count;
+    }
+
+    /// @brief Returns a reference to the slot at @p index, preserving the constness of @p self.
+    /// @pre `index < size()`.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto operator[](this Self&& self, size_type const index) noexcept -> auto& {
+        return std::forward<Self>(self).data()[index];
+    }
+
+    /// @brief Returns a span over the slots, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    constexpr auto slots(this Self&& self) noexcept -> std::ranges::borrowed_range auto {
+        return std::span(std::forward<Self>(self).data(), self.count);
+    }
+
+  private:
+    using allocator_type = std::allocator<maybe_uninit<T>>;
+
+    /// @brief Deallocates the slots, if any.
+    constexpr auto release() noexcept {
+        if (this->first != nullptr) {
+            std::destroy_n(this->first, this->count);
+            allocator_type().deallocate(this->first, this->count);
+        }
+    }
+
+    /// @brief The first slot, or `nullptr` if the buffer is empty.
+    maybe_uninit<T>* first = nullptr;
+
+    /// @brief Number of slots.
+    size_type count = 0;
+};
+
+} // namespace MAYBE_UNINIT_NAMESPACE
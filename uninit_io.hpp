@@ -0,0 +1,240 @@
+/// @file
+/// @brief Defines helpers which read from file descriptors straight into `maybe_uninit` slots, and return the objects
+/// read, so that receive buffers needn't be zeroed first. POSIX only, with io_uring helpers on Linux.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <expected>
+#include <limits>
+#include <memory>
+#include <span>
+#include <system_error>
+
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <unistd.h>
+
+#if __has_include(<linux/io_uring.h>)
+#   include <linux/io_uring.h>
+#endif
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+/// @brief Outcome of a successful read into slots of `T`s: the whole objects read, followed by the bytes read of an
+/// incomplete object, if reading stopped in the middle of one.
+template <typename T>
+struct read_objects {
+    /// @brief The objects read, whose lifetimes are started.
+    std::span<T> objects;
+
+    /// @brief The bytes read of the object following `objects`, at the start of its slot, whose lifetime isn't
+    /// started. Empty unless end of file was reached or an error occurred in the middle of an object. Such bytes are
+    /// consumed from the file descriptor, so the caller must keep them to complete the object, e.g. by moving them to
+    /// the front of the slots before reading again.
+    std::span<std::byte> partial;
+};
+
+namespace detail {
+
+/// @brief Matches `slot_range`s whose objects can be read from bytes, i.e. whose object type is implicit-lifetime.
+template <typename R>
+concept readable_slot_range = slot_range<R> and implicit_lifetime<slot_value_t<R>>;
+
+/// @brief Result of the read helpers: the objects read, or the error which occurred.
+template <typename R>
+using read_result = std::expected<read_objects<slot_value_t<R>>, std::error_code>;
+
+/// @brief Starts the lifetimes of the objects whose bytes are the first @p filled bytes of @p slots.
+/// @returns The objects, followed by the bytes of the trailing incomplete object, if any.
+template <readable_slot_range R>
+auto objects_from_bytes(R&& slots, std::size_t const filled) noexcept -> read_objects<slot_value_t<R>> {
+    using T = slot_value_t<R>;
+    auto const whole = filled / sizeof(T);
+    auto const partial = std::as_writable_bytes(std::span(slots)).subspan(whole * sizeof(T), filled % sizeof(T));
+    return {.objects = assume_init_from_bytes(std::span(slots).first(whole)), .partial = partial};
+}
+
+/// @brief Fills the bytes of @p slots by invoking `io(destination, size, offset)`, which returns the number of bytes
+/// read, `0` upon end of file, or `-1` after setting `errno`. Retries upon `EINTR`, and keeps reading until the bytes
+/// read form whole objects.
+/// @returns The objects read, whose lifetimes are started, or the error which occurred if nothing was read. An error
+/// occurring after some bytes were read ends the read instead, like a short `read()`, so that those bytes aren't
+/// lost, and is reported by the next call if it persists.
+template <readable_slot_range R, typename IO>
+auto fill_slots(R&& slots, IO io) -> read_result<R> {
+    using T = slot_value_t<R>;
+    auto const bytes = std::as_writable_bytes(std::span(slots));
+    auto filled = std::size_t{0};
+    while (true) {
+        auto const n = io(bytes.data() + filled, bytes.size() - filled, filled);
+        if (n > 0) {
+            filled += static_cast<std::size_t>(n);
+            if (filled % sizeof(T) == 0) {
+                break;
+            }
+        } else if (n == 0) {
+            break;
+        } else if (errno != EINTR) {
+            if (filled == 0) {
+                return std::unexpected(std::error_code(errno, std::system_category()));
+            }
+            break;
+        }
+    }
+    return objects_from_bytes(slots, filled);
+}
+
+} // namespace detail
+
+/// @brief Reads from @p fd into the bytes of @p slots via `read()`, and starts the lifetimes of the objects read.
+/// @details Nothing is zeroed beforehand, and objects are neither copied nor constructed:
+/// @code {.cpp}
+///     auto buffer = uninit_buffer<std::byte>(1 << 20);
+///     if (auto received = read_into(fd, buffer)) {
+///         parse(received->objects); // std::span<std::byte> over the bytes read.
+///     }
+/// @endcode
+/// Calls `read()` again upon `EINTR`, and while the bytes read end in the middle of an object.
+/// @param fd File descriptor to read from.
+/// @param slots Slots to read into, such as an `uninit_buffer<T>` or a `std::span<maybe_uninit<T>>`.
+/// @returns The objects read, which may be empty upon end of file, and the bytes of a trailing incomplete object, or
+/// the error reported by `read()` if nothing was read.
+/// @attention The slots are assumed not to hold objects. If end of file is reached or an error occurs in the middle
+/// of an object, the bytes read of that object are returned in `read_objects::partial`.
+/// @relatedalso maybe_uninit
+template <detail::readable_slot_range R>
+auto read_into(int const fd, R&& slots) -> detail::read_result<R> {
+    return detail::fill_slots(slots, [fd](std::byte* const destination, std::size_t const size, std::size_t) {
+        return ::read(fd, destination, size);
+    });
+}
+
+/// @brief Reads from @p fd at @p offset into the bytes of @p slots via `pread()`, and starts the lifetimes of the
+/// objects read.
+/// @details Calls `pread()` again upon `EINTR`, and while the bytes read end in the middle of an object.
+/// @param fd File descriptor to read from.
+/// @param slots Slots to read into, such as an `uninit_buffer<T>` or a `std::span<maybe_uninit<T>>`.
+/// @param offset Offset in the file to start reading at.
+/// @returns The objects read, which may be empty upon end of file, and the bytes of a trailing incomplete object, or
+/// the error reported by `pread()` if nothing was read.
+/// @attention The slots are assumed not to hold objects. If end of file is reached or an error occurs in the middle
+/// of an object, the bytes read of that object are returned in `read_objects::partial`.
+/// @relatedalso maybe_uninit
+template <detail::readable_slot_range R>
+auto pread_into(int const fd, R&& slots, off_t const offset) -> detail::read_result<R> {
+    return detail::fill_slots(
+        slots,
+        [fd, offset](std::byte* const destination, std::size_t const size, std::size_t const filled) {
+            return ::pread(fd, destination, size, offset + static_cast<off_t>(filled));
+        }
+    );
+}
+
+/// @brief Receives from the socket @p fd into the bytes of @p slots via `recv()`, and starts the lifetimes of the
+/// objects received.
+/// @details Calls `recv()` again upon `EINTR`, and while the bytes received end in the middle of an object.
+/// @param fd Socket to receive from.
+/// @param slots Slots to receive into, such as an `uninit_buffer<T>` or a `std::span<maybe_uninit<T>>`.
+/// @param flags Flags passed to `recv()`.
+/// @returns The objects received, which may be empty if the peer shut down, and the bytes of a trailing incomplete
+/// object, or the error reported by `recv()` if nothing was received.
+/// @attention The slots are assumed not to hold objects. If the peer shuts down or an error occurs in the middle of an
+/// object, e.g. `EAGAIN` on a non-blocking socket, the bytes received of that object are returned in
+/// `read_objects::partial`. On datagram sockets, each datagram must hold whole objects.
+/// @relatedalso maybe_uninit
+template <detail::readable_slot_range R>
+auto recv_into(int const fd, R&& slots, int const flags = 0) -> detail::read_result<R> {
+    return detail::fill_slots(slots, [fd, flags](std::byte* const destination, std::size_t const size, std::size_t) {
+        return ::recv(fd, destination, size, flags);
+    });
+}
+
+#if __has_include(<linux/io_uring.h>)
+
+namespace detail {
+
+/// @brief Returns the length of a submission reading into @p size bytes of slots of `T`s: @p size, clamped to the
+/// largest multiple of `sizeof(T)` which fits in the 32-bit length of a submission queue entry.
+template <typename T>
+constexpr auto uring_length(std::size_t const size) noexcept -> std::uint32_t {
+    constexpr auto max_length = std::size_t{std::numeric_limits<std::uint32_t>::max()} / sizeof(T) * sizeof(T);
+    return static_cast<std::uint32_t>(std::min(size, max_length));
+}
+
+} // namespace detail
+
+/// @brief Prepares @p sqe to read from @p fd at @p offset into the bytes of @p slots, as `IORING_OP_READ`.
+/// @details All other fields of @p sqe are zeroed, so `user_data` and flags must be set afterwards. Once the
+/// completion is reaped, pass its result to `complete_into()`:
+/// @code {.cpp}
+///     prep_read_into(*sqe, fd, buffer, offset);
+///     sqe->user_data = id;
+///     // submit, then wait for the completion...
+///     auto records = complete_into(buffer, cqe->res);
+/// @endcode
+/// @param sqe Submission queue entry to prepare.
+/// @param fd File descriptor to read from.
+/// @param slots Slots to read into, which must outlive the operation.
+/// @param offset Offset in the file to start reading at, or `-1` to use and advance the file position.
+/// @attention The slots are assumed not to hold objects. At most 4 GiB are read, rounded down to whole objects, as
+/// the length of a submission is 32-bit.
+/// @relatedalso maybe_uninit
+template <detail::readable_slot_range R>
+auto prep_read_into(io_uring_sqe& sqe, int const fd, R&& slots, std::uint64_t const offset) noexcept {
+    auto const bytes = std::as_writable_bytes(std::span(slots));
+    std::memset(std::addressof(sqe), 0, sizeof(sqe));
+    sqe.opcode = IORING_OP_READ;
+    sqe.fd = fd;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    sqe.addr = reinterpret_cast<std::uintptr_t>(bytes.data());
+    sqe.len = detail::uring_length<detail::slot_value_t<R>>(bytes.size());
+    sqe.off = offset;
+}
+
+/// @brief Prepares @p sqe to receive from the socket @p fd into the bytes of @p slots, as `IORING_OP_RECV`.
+/// @details All other fields of @p sqe are zeroed, so `user_data` and flags must be set afterwards. Once the
+/// completion is reaped, pass its result to `complete_into()`.
+/// @param sqe Submission queue entry to prepare.
+/// @param fd Socket to receive from.
+/// @param slots Slots to receive into, which must outlive the operation.
+/// @param flags Flags passed to `recv()`.
+/// @attention The slots are assumed not to hold objects. At most 4 GiB are received, rounded down to whole objects,
+/// as the length of a submission is 32-bit.
+/// @relatedalso maybe_uninit
+template <detail::readable_slot_range R>
+auto prep_recv_into(io_uring_sqe& sqe, int const fd, R&& slots, int const flags = 0) noexcept {
+    auto const bytes = std::as_writable_bytes(std::span(slots));
+    std::memset(std::addressof(sqe), 0, sizeof(sqe));
+    sqe.opcode = IORING_OP_RECV;
+    sqe.fd = fd;
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+    sqe.addr = reinterpret_cast<std::uintptr_t>(bytes.data());
+    sqe.len = detail::uring_length<detail::slot_value_t<R>>(bytes.size());
+    sqe.msg_flags = static_cast<std::uint32_t>(flags);
+}
+
+/// @brief Starts the lifetimes of the objects read into @p slots by an operation prepared by `prep_read_into()` or
+/// `prep_recv_into()`, whose completion result is @p res.
+/// @returns The objects read, and the bytes of the trailing incomplete object, or the error reported by the
+/// operation.
+/// @attention If the operation ended in the middle of an object, the bytes read of that object are returned in
+/// `read_objects::partial`.
+/// @relatedalso maybe_uninit
+template <detail::readable_slot_range R>
+auto complete_into(R&& slots, std::int32_t const res) noexcept -> detail::read_result<R> {
+    if (res < 0) {
+        return std::unexpected(std::error_code(-res, std::system_category()));
+    }
+    return detail::objects_from_bytes(slots, static_cast<std::size_t>(res));
+}
+
+#endif
+
+} // namespace MAYBE_UNINIT_NAMESPACE
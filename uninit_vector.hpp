@@ -0,0 +1,437 @@
+/// @file
+/// @brief Defines the template type `uninit_vector`, a vector of `maybe_uninit` slots which can grow without
+/// initializing its new elements.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdlib>
+#include <limits>
+#include <memory>
+#include <new>
+#include <span>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+/// @brief Vector whose spare capacity is exposed as `maybe_uninit<T>` slots, so that elements can be written in place
+/// and then committed, without being value-initialized first.
+/// @details `std::vector<T>::resize()` value-initializes new elements, zeroing them for trivial `T`s, which doubles the
+/// memory traffic of buffers which are then overwritten, such as compression or encoding outputs. `uninit_vector`
+/// instead offers:
+/// - `resize_for_overwrite(n)`, which default-initializes new elements, i.e. leaves trivial ones uninitialized;
+/// - `append_uninit(n)`, which returns `n` slots past the end, to be constructed by the caller, e.g. with the bulk
+/// functions or by writing to their bytes;
+/// - `commit(k)`, which appends the first `k` of those slots to the elements.
+/// @code {.cpp}
+///     auto out = uninit_vector<std::byte>{};
+///     std::span<maybe_uninit<std::byte>> spare = out.append_uninit(compress_bound(input.size()));
+///     auto const written = compress(input, std::as_writable_bytes(spare));
+///     assume_init_from_bytes(spare.first(written));
+///     out.commit(written);
+/// @endcode
+/// Trivially relocatable `T`s which aren't over-aligned grow with `std::realloc`, which may extend the buffer in place
+/// or remap its pages instead of copying it. Other `T`s are relocated to a buffer from `std::allocator` with
+/// `relocate_all()`.
+/// @tparam T Type of the elements.
+template <detail::sized T>
+class uninit_vector {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T&;
+    using const_reference = T const&;
+    using pointer = T*;
+    using const_pointer = T const*;
+    using iterator = T*;
+    using const_iterator = T const*;
+
+    /// @brief Default constructor. Constructs an empty vector, without allocating.
+    uninit_vector() noexcept = default;
+
+    /// @brief Copy constructor. Copy constructs the elements of @p other, with a single `memcpy` for trivially
+    /// copyable `T`s.
+    /// @note Propagates exceptions thrown by `T`'s copy constructor or by the allocator, after releasing everything
+    /// acquired so far.
+    uninit_vector(uninit_vector const& other)
+        requires std::copy_constructible<T>
+    {
+        this->reserve(other.count);
+        try {
+            init_from_range(std::span(this->slots, other.count), other.span());
+        } catch (...) {
+            this->deallocate(this->slots, this->cap);
+            throw;
+        }
+        this->count = other.count;
+    }
+
+    /// @brief Move constructor. Steals the buffer of @p other, leaving it empty.
+    uninit_vector(uninit_vector&& other) noexcept
+        : slots(std::exchange(other.slots, nullptr))
+        , cap(std::exchange(other.cap, 0))
+        , count(std::exchange(other.count, 0)) {}
+
+    /// @brief Copy assignment operator. Destroys the current elements, then copy constructs the elements of @p other.
+    /// @note Propagates exceptions thrown by `T`'s copy constructor or by the allocator, in which case the vector is
+    /// left empty.
+    auto operator=(uninit_vector const& other) -> uninit_vector&
+        requires std::copy_constructible<T>
+    {
+        if (this != std::addressof(other)) {
+            this->clear();
+            this->reserve(other.count);
+            init_from_range(std::span(this->slots, other.count), other.span());
+            this->count = other.count;
+        }
+        return *this;
+    }
+
+    /// @brief Move assignment operator. Releases the current elements, then steals the buffer of @p other, leaving it
+    /// empty.
+    auto operator=(uninit_vector&& other) noexcept -> uninit_vector& {
+        if (this != std::addressof(other)) {
+            this->reset();
+            this->slots = std::exchange(other.slots, nullptr);
+            this->cap = std::exchange(other.cap, 0);
+            this->count = std::exchange(other.count, 0);
+        }
+        return *this;
+    }
+
+    /// @brief Destructor. Destroys every element and releases the buffer.
+    ~uninit_vector() {
+        this->reset();
+    }
+
+    /// @brief Returns the number of elements.
+    [[nodiscard]]
+    auto size() const noexcept -> size_type {
+        return this->count;
+    }
+
+    /// @brief Returns the number of slots in the buffer.
+    [[nodiscard]]
+    auto capacity() const noexcept -> size_type {
+        return this->cap;
+    }
+
+    /// @brief Returns whether the vector holds no elements.
+    [[nodiscard]]
+    auto empty() const noexcept -> bool {
+        return this->count == 0;
+    }
+
+    /// @brief Returns a pointer to the storage of the first element, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    // NOLINTNEXTLINE(cppcoreguidelines-missing-std-forward)
+    auto data(this Self&& self) noexcept -> auto* {
+        using object_type = std::conditional_t<std::is_const_v<std::remove_reference_t<Self>>, T const, T>;
+        // maybe_uninit<T> and T are pointer-interconvertible.
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return reinterpret_cast<object_type*>(self.slots);
+    }
+
+    /// @brief Returns an iterator to the first element, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    auto begin(this Self&& self) noexcept -> auto* {
+        return std::forward<Self>(self).data();
+    }
+
+    /// @brief Returns an iterator past the last element, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    auto end(this Self&& self) noexcept -> auto* {
+        return std::forward<Self>(self).data() + self.count;
+    }
+
+    /// @brief Returns a reference to the element at @p index, preserving the constness of @p self.
+    /// @pre `index < size()`.
+    template <typename Self>
+    [[nodiscard]]
+    auto operator[](this Self&& self, size_type const index) noexcept -> auto& {
+        return std::forward<Self>(self).data()[index];
+    }
+
+    /// @brief Returns a span over the elements, preserving the constness of @p self.
+    template <typename Self>
+    [[nodiscard]]
+    auto span(this Self&& self) noexcept -> std::ranges::borrowed_range auto {
+        return std::span(std::forward<Self>(self).data(), self.count);
+    }
+
+    /// @brief Returns the largest number of elements the vector can hold.
+    [[nodiscard]]
+    static constexpr auto max_size() noexcept -> size_type {
+        return static_cast<size_type>(std::numeric_limits<difference_type>::max()) / sizeof(maybe_uninit<T>);
+    }
+
+    /// @brief Ensures the buffer can hold at least @p new_cap elements.
+    /// @note Throws `std::length_error` if @p new_cap exceeds `max_size()`.
+    /// @note Propagates exceptions thrown by the allocator or by `T`'s move constructor, in which case the vector is
+    /// left unchanged.
+    auto reserve(size_type const new_cap) {
+        if (new_cap > max_size()) {
+            throw std::length_error("uninit_vector::reserve");
+        }
+        if (new_cap > this->cap) {
+            this->grow_to(new_cap);
+        }
+    }
+
+    /// @brief Returns the @p n slots following the last element, growing the buffer if needed, without constructing
+    /// anything. Construct objects in a prefix of them, then call `commit()` to make them elements.
+    /// @returns A span over the slots.
+    /// @note Throws `std::length_error` if `size() + n` exceeds `max_size()`.
+    /// @note Propagates exceptions thrown by the allocator or by `T`'s move constructor, in which case the vector is
+    /// left unchanged.
+    [[nodiscard]]
+    auto append_uninit(size_type const n) -> std::span<maybe_uninit<T>> {
+        if (n > max_size() - this->count) {
+            throw std::length_error("uninit_vector::append_uninit");
+        }
+        if (n > this->cap - this->count) {
+            this->grow_to(this->next_capacity(this->count + n));
+        }
+        return std::span(this->slots + this->count, n);
+    }
+
+    /// @brief Makes the @p k slots following the last element elements.
+    /// @pre The objects of those slots are constructed, e.g. after `append_uninit(n)`, with `k <= n`.
+    auto commit(size_type const k) noexcept {
+        this->count += k;
+    }
+
+    /// @brief Resizes the vector to @p n elements. New elements are default-initialized, which leaves trivial ones
+    /// uninitialized, and excess ones are destroyed.
+    /// @note Throws `std::length_error` if @p n exceeds `max_size()`.
+    /// @note Propagates exceptions thrown by the allocator or by `T`'s default constructor, in which case the vector is
+    /// left unchanged.
+    auto resize_for_overwrite(size_type const n)
+        requires detail::default_constructible<T>
+    {
+        if (n <= this->count) {
+            this->destroy_from(n);
+            return;
+        }
+        auto const added = this->append_uninit(n - this->count);
+        // Slots of trivial types are neither initialized nor poisoned, so they're usable as they are.
+        if constexpr (not std::is_trivially_default_constructible_v<T> or not std::is_trivially_destructible_v<T>) {
+            auto constructed = size_type{0};
+            try {
+                for (; constructed != added.size(); ++constructed) {
+                    added[constructed].default_init();
+                }
+            } catch (...) {
+                destroy_all(added.first(constructed));
+                throw;
+            }
+        }
+        this->commit(added.size());
+    }
+
+    /// @brief Constructs an element at the end as if by `T(std::forward<Args>(args)...)`, growing the buffer if it's
+    /// full.
+    /// @returns A reference to the constructed element.
+    /// @note @p args may refer to elements of the vector.
+    /// @note Propagates exceptions thrown by `T`'s selected constructor or by the allocator, in which case the vector
+    /// is left unchanged.
+    template <typename... Args>
+    auto emplace_back(Args&&... args) -> T&
+        requires detail::paren_constructible_from<T, Args...>
+    {
+        if (this->count == this->cap) {
+            return this->grow_and_emplace_back(std::forward<Args>(args)...);
+        }
+        auto& object = this->slots[this->count].paren_init(std::forward<Args>(args)...);
+        ++this->count;
+        return object;
+    }
+
+    /// @brief Copy constructs @p value at the end.
+    auto push_back(T const& value) -> T&
+        requires std::is_copy_constructible_v<T>
+    {
+        return this->emplace_back(value);
+    }
+
+    /// @brief Move constructs @p value at the end.
+    auto push_back(T&& value) -> T&
+        requires std::is_move_constructible_v<T>
+    {
+        return this->emplace_back(std::move(value));
+    }
+
+    /// @brief Destroys the last element.
+    /// @pre `not empty()`.
+    auto pop_back() noexcept(std::is_nothrow_destructible_v<T>) {
+        --this->count;
+        this->slots[this->count].destroy();
+    }
+
+    /// @brief Destroys every element. The capacity is left unchanged.
+    auto clear() noexcept(std::is_nothrow_destructible_v<T>) {
+        this->destroy_from(0);
+    }
+
+  private:
+    using allocator_type = std::allocator<maybe_uninit<T>>;
+
+    /// @brief Whether the buffer is managed with `std::malloc`, `std::realloc` and `std::free`, which is sound for
+    /// trivially relocatable `T`s that `std::malloc` aligns suitably.
+    static constexpr auto use_realloc = is_trivially_relocatable_v<T>
+                                    and alignof(T) <= __STDCPP_DEFAULT_NEW_ALIGNMENT__;
+
+    /// @brief Returns the capacity to grow to in order to hold at least @p required elements, which is at most
+    /// `max_size()`.
+    /// @note Throws `std::length_error` if @p required exceeds `max_size()`.
+    [[nodiscard]]
+    auto next_capacity(size_type const required) const -> size_type {
+        if (required > max_size()) {
+            throw std::length_error("uninit_vector");
+        }
+        return std::max(std::min(this->cap * 2, max_size()), required);
+    }
+
+    /// @brief Releases @p buffer, a buffer of @p n slots, if not null.
+    static auto deallocate(maybe_uninit<T>* const buffer, size_type const n) noexcept {
+        if (buffer == nullptr) {
+            return;
+        }
+        if constexpr (use_realloc) {
+            std::free(buffer);
+        } else {
+            allocator_type().deallocate(buffer, n);
+        }
+    }
+
+    /// @brief Moves the elements to a buffer of @p new_cap slots, which replaces the current one.
+    /// @details For trivially relocatable `T`s, this is a `std::realloc`. Otherwise, elements are relocated with
+    /// `relocate_all()` when that can't throw, or else copied and the originals destroyed.
+    /// @note Propagates exceptions thrown by the allocator or by `T`'s copy constructor, in which case the vector is
+    /// left unchanged.
+    auto grow_to(size_type const new_cap) {
+        if constexpr (use_realloc) {
+            if (new_cap > std::numeric_limits<size_type>::max() / sizeof(maybe_uninit<T>)) {
+                throw std::bad_array_new_length();
+            }
+            auto* const new_slots = std::realloc(this->slots, new_cap * sizeof(maybe_uninit<T>));
+            if (new_slots == nullptr) {
+                throw std::bad_alloc();
+            }
+            this->slots = static_cast<maybe_uninit<T>*>(new_slots);
+        } else {
+            auto* const new_slots = allocator_type().allocate(new_cap);
+            if constexpr (detail::nothrow_relocatable<T>) {
+                relocate_all(std::span(this->slots, this->count), std::span(new_slots, this->count));
+            } else {
+                auto moved = size_type{0};
+                try {
+                    for (; moved != this->count; ++moved) {
+                        new_slots[moved].paren_init(std::move_if_noexcept(this->slots[moved].ref()));
+                    }
+                } catch (...) {
+                    destroy_all(std::span(new_slots, moved));
+                    allocator_type().deallocate(new_slots, new_cap);
+                    throw;
+                }
+                destroy_all(std::span(this->slots, this->count));
+            }
+            deallocate(this->slots, this->cap);
+            this->slots = new_slots;
+        }
+        this->cap = new_cap;
+    }
+
+    /// @brief Constructs a new element at the end of a larger buffer.
+    /// @details The new element is constructed before the buffer grows, as @p args may refer to elements of the
+    /// vector. With `std::realloc`, it's staged in a local slot and relocated afterwards, as the buffer can't be
+    /// written to before it's reallocated.
+    template <typename... Args>
+    auto grow_and_emplace_back(Args&&... args) -> T& {
+        auto const new_cap = this->next_capacity(this->count + 1);
+        if constexpr (use_realloc) {
+            auto staged = maybe_uninit<T>(paren_init_t{}, std::forward<Args>(args)...);
+            try {
+                this->grow_to(new_cap);
+            } catch (...) {
+                staged.destroy();
+                throw;
+            }
+            auto& object = staged.relocate_into(this->slots[this->count]);
+            ++this->count;
+            return object;
+        } else {
+            auto* const new_slots = allocator_type().allocate(new_cap);
+            auto& new_slot = new_slots[this->count];
+            try {
+                new_slot.paren_init(std::forward<Args>(args)...);
+            } catch (...) {
+                allocator_type().deallocate(new_slots, new_cap);
+                throw;
+            }
+            auto* const old_slots = this->slots;
+            auto const old_cap = this->cap;
+            if constexpr (detail::nothrow_relocatable<T>) {
+                relocate_all(std::span(old_slots, this->count), std::span(new_slots, this->count));
+            } else {
+                auto moved = size_type{0};
+                try {
+                    for (; moved != this->count; ++moved) {
+                        new_slots[moved].paren_init(std::move_if_noexcept(old_slots[moved].ref()));
+                    }
+                } catch (...) {
+                    destroy_all(std::span(new_slots, moved));
+                    new_slot.destroy();
+                    allocator_type().deallocate(new_slots, new_cap);
+                    throw;
+                }
+                destroy_all(std::span(old_slots, this->count));
+            }
+            deallocate(old_slots, old_cap);
+            this->slots = new_slots;
+            this->cap = new_cap;
+            ++this->count;
+            return new_slot.ref();
+        }
+    }
+
+    /// @brief Destroys the elements starting at @p new_count, in reverse order.
+    auto destroy_from(size_type const new_count) noexcept(std::is_nothrow_destructible_v<T>) {
+        if constexpr (std::is_trivially_destructible_v<T>) {
+            this->count = std::min(this->count, new_count);
+        } else {
+            while (this->count > new_count) {
+                this->pop_back();
+            }
+        }
+    }
+
+    /// @brief Destroys every element and releases the buffer.
+    auto reset() noexcept(std::is_nothrow_destructible_v<T>) {
+        this->clear();
+        deallocate(this->slots, this->cap);
+        this->slots = nullptr;
+        this->cap = 0;
+    }
+
+    /// @brief The buffer, whose first `count` slots are constructed, or `nullptr` if nothing was allocated.
+    maybe_uninit<T>* slots = nullptr;
+
+    /// @brief Number of slots in the buffer.
+    size_type cap = 0;
+
+    /// @brief Number of constructed elements.
+    size_type count = 0;
+};
+
+} // namespace MAYBE_UNINIT_NAMESPACE
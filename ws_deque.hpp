@@ -0,0 +1,244 @@
+/// @file
+/// @brief Defines the template type `ws_deque`, a Chase-Lev work-stealing deque whose buffer is made of `maybe_uninit`
+/// slots.
+
+#pragma once
+
+#include "maybe_uninit.hpp"
+#include "uninit_buffer.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <cstddef>
+#include <cstring>
+#include <deque>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+namespace MAYBE_UNINIT_NAMESPACE {
+
+/// @brief Lock-free, unbounded work-stealing deque, after Chase and Lev's design.
+/// @details Elements are stored in place in a growable circular array of `maybe_uninit<T>` slots, so pushing a task
+/// costs no allocation unless the array is full. The owning thread pushes and pops at the bottom, LIFO, while any
+/// number of thieves steal from the top, FIFO:
+/// @code {.cpp}
+///     auto tasks = ws_deque<Task>(256);
+///
+///     // Owner thread.
+///     tasks.emplace(function, arguments);
+///     while (std::optional<Task> task = tasks.pop()) {
+///         (*task)();
+///     }
+///
+///     // Thief threads.
+///     if (std::optional<Task> task = victim.steal()) {
+///         (*task)();
+///     }
+/// @endcode
+/// A thief copies the object representation of the top element before claiming it, and discards the copy if another
+/// thread claimed it first, which is only sound for trivially relocatable `T`s. For the same reason, growing the array
+/// copies the elements with `memcpy`, and the previous array is kept alive until the deque is destroyed, as thieves may
+/// still be reading from it.
+/// @note The speculative copy may overlap with the owner constructing a new element in the same slot, once the array
+/// has wrapped around. The copy is then discarded, but ThreadSanitizer reports it as a data race.
+/// @tparam T Type of the elements. Must be trivially relocatable.
+/// @attention Only the owning thread may call `emplace()`, `push()` and `pop()`. Any thread may call `steal()`.
+/// @see `is_trivially_relocatable`
+template <detail::sized T>
+    requires(is_trivially_relocatable_v<T> and std::is_nothrow_destructible_v<T>)
+class ws_deque {
+  public:
+    using value_type = T;
+    using size_type = std::size_t;
+
+    /// @brief Constructs an empty deque whose array holds @p capacity slots, rounded up to a power of 2 as positions
+    /// are masked into the array, performing no initialization on them.
+    /// @note Propagates exceptions thrown by the allocator.
+    explicit ws_deque(size_type const capacity = 64) {
+        auto const slot_count = std::bit_ceil(std::max(capacity, size_type{1}));
+        this->ring.store(std::addressof(this->buffers.emplace_back(slot_count)), std::memory_order_relaxed);
+    }
+
+    ws_deque(ws_deque const&) = delete;
+    ws_deque(ws_deque&&) = delete;
+    auto operator=(ws_deque const&) -> ws_deque& = delete;
+    auto operator=(ws_deque&&) -> ws_deque& = delete;
+
+    /// @brief Destructor. Destroys the elements which were pushed but neither popped nor stolen.
+    /// @pre No thread is accessing the deque.
+    ~ws_deque() {
+        auto& slots = *this->ring.load(std::memory_order_relaxed);
+        auto const bottom = this->bottom.load(std::memory_order_relaxed);
+        for (auto i = this->top.load(std::memory_order_relaxed); i < bottom; ++i) {
+            slot_at(slots, i).destroy();
+        }
+    }
+
+    /// @brief Owner function. Constructs an element at the bottom as if by `T(std::forward<Args>(args)...)`, doubling
+    /// the capacity of the array if it's full.
+    /// @note Propagates exceptions thrown by the allocator and by `T`'s selected constructor, in which case nothing is
+    /// pushed.
+    template <typename... Args>
+    auto emplace(Args&&... args)
+        requires detail::paren_constructible_from<T, Args...>
+    {
+        auto const bottom = this->bottom.load(std::memory_order_relaxed);
+        auto const top = this->top.load(std::memory_order_acquire);
+        auto* slots = this->ring.load(std::memory_order_relaxed);
+        if (bottom - top >= std::ssize(*slots)) {
+            slots = this->grow(*slots, top, bottom);
+        }
+        slot_at(*slots, bottom).paren_init(std::forward<Args>(args)...);
+        this->bottom.store(bottom + 1, std::memory_order_release);
+    }
+
+    /// @brief Owner function. Copy constructs @p value at the bottom.
+    auto push(T const& value)
+        requires std::is_copy_constructible_v<T>
+    {
+        this->emplace(value);
+    }
+
+    /// @brief Owner function. Move constructs @p value at the bottom.
+    auto push(T&& value)
+        requires std::is_move_constructible_v<T>
+    {
+        this->emplace(std::move(value));
+    }
+
+    /// @brief Owner function. Relocates the bottom element into @p dst, if the deque isn't empty.
+    /// @returns Whether an element was popped.
+    /// @attention @p dst is assumed not to hold an object.
+    auto pop(maybe_uninit<T>& dst) noexcept -> bool {
+        auto const bottom = this->bottom.load(std::memory_order_relaxed) - 1;
+        auto& slots = *this->ring.load(std::memory_order_relaxed);
+        // Reserves the bottom element before looking at top, so that thieves see it's taken.
+        this->bottom.store(bottom, std::memory_order_seq_cst);
+        auto top = this->top.load(std::memory_order_seq_cst);
+        if (top > bottom) {
+            this->bottom.store(bottom + 1, std::memory_order_relaxed);
+            return false;
+        }
+        if (top == bottom) {
+            // Last element, which thieves may be racing for.
+            auto const won = this->top.compare_exchange_strong(
+                top,
+                top + 1,
+                std::memory_order_seq_cst,
+                std::memory_order_relaxed
+            );
+            this->bottom.store(bottom + 1, std::memory_order_relaxed);
+            if (not won) {
+                return false;
+            }
+        }
+        copy_object(slot_at(slots, bottom), dst);
+        return true;
+    }
+
+    /// @brief Owner function. Moves the bottom element out, if the deque isn't empty.
+    /// @returns The popped element, or `std::nullopt` if the deque is empty.
+    [[nodiscard]]
+    auto pop() noexcept(std::is_nothrow_move_constructible_v<T>) -> std::optional<T>
+        requires std::is_move_constructible_v<T>
+    {
+        auto slot = maybe_uninit<T>{};
+        if (not this->pop(slot)) {
+            return std::nullopt;
+        }
+        return take(slot);
+    }
+
+    /// @brief Thief function. Relocates the top element into @p dst, if the deque isn't empty and no other thread
+    /// claims it first.
+    /// @returns Whether an element was stolen.
+    /// @attention @p dst is assumed not to hold an object. Its bytes are clobbered even if no element is stolen.
+    auto steal(maybe_uninit<T>& dst) noexcept -> bool {
+        auto top = this->top.load(std::memory_order_seq_cst);
+        auto const bottom = this->bottom.load(std::memory_order_seq_cst);
+        if (top >= bottom) {
+            return false;
+        }
+        // Speculative copy, only kept if the element is claimed below. Sound because T is trivially relocatable and
+        // arrays are never freed while the deque is alive.
+        copy_object(slot_at(*this->ring.load(std::memory_order_acquire), top), dst);
+        return this->top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed);
+    }
+
+    /// @brief Thief function. Moves the top element out, if the deque isn't empty and no other thread claims it first.
+    /// @returns The stolen element, or `std::nullopt` if none was stolen.
+    [[nodiscard]]
+    auto steal() noexcept(std::is_nothrow_move_constructible_v<T>) -> std::optional<T>
+        requires std::is_move_constructible_v<T>
+    {
+        auto slot = maybe_uninit<T>{};
+        if (not this->steal(slot)) {
+            return std::nullopt;
+        }
+        return take(slot);
+    }
+
+    /// @brief Returns the number of elements. Only a snapshot if other threads are accessing the deque.
+    [[nodiscard]]
+    auto size() const noexcept -> size_type {
+        auto const bottom = this->bottom.load(std::memory_order_relaxed);
+        auto const top = this->top.load(std::memory_order_relaxed);
+        return bottom > top ? static_cast<size_type>(bottom - top) : 0;
+    }
+
+    /// @brief Returns whether the deque holds no elements. Only a snapshot if other threads are accessing the deque.
+    [[nodiscard]]
+    auto empty() const noexcept -> bool {
+        return this->size() == 0;
+    }
+
+  private:
+    using position_type = std::ptrdiff_t;
+
+    /// @brief Returns the slot of @p slots at position @p pos, modulo the size of @p slots.
+    static auto slot_at(uninit_buffer<T>& slots, position_type const pos) noexcept -> maybe_uninit<T>& {
+        return slots[static_cast<size_type>(pos) & (slots.size() - 1)];
+    }
+
+    /// @brief Copies the object representation of @p src into @p dst, leaving @p src readable by other thieves.
+    static auto copy_object(maybe_uninit<T>& src, maybe_uninit<T>& dst) noexcept {
+        std::memcpy(dst.bytes().data(), src.bytes().data(), sizeof(T));
+    }
+
+    /// @brief Moves the object of @p slot out and destroys it.
+    static auto take(maybe_uninit<T>& slot) noexcept(std::is_nothrow_move_constructible_v<T>) -> std::optional<T> {
+        auto result = std::optional<T>(std::in_place, std::move(*std::launder(slot.ptr())));
+        slot.destroy();
+        return result;
+    }
+
+    /// @brief Owner function. Allocates an array twice as large as @p slots, so that its size remains a power of 2,
+    /// copies the elements in `[top, bottom)` into it and publishes it.
+    /// @returns The new array.
+    /// @note Propagates exceptions thrown by the allocator, in which case the current array is kept.
+    auto grow(uninit_buffer<T>& slots, position_type const top, position_type const bottom) -> uninit_buffer<T>* {
+        auto& grown = this->buffers.emplace_back(slots.size() * 2);
+        for (auto i = top; i != bottom; ++i) {
+            copy_object(slot_at(slots, i), slot_at(grown, i));
+        }
+        this->ring.store(std::addressof(grown), std::memory_order_release);
+        return std::addressof(grown);
+    }
+
+    /// @brief Position of the top element, incremented by thieves and by the owner when popping the last element.
+    alignas(detail::cache_line_size) std::atomic<position_type> top = 0;
+
+    /// @brief Position past the bottom element. Written by the owner.
+    alignas(detail::cache_line_size) std::atomic<position_type> bottom = 0;
+
+    /// @brief The current array.
+    std::atomic<uninit_buffer<T>*> ring = nullptr;
+
+    /// @brief Every array allocated so far, the last one being the current one. A `std::deque` so that growing doesn't
+    /// move the arrays thieves may be reading from.
+    std::deque<uninit_buffer<T>> buffers;
+};
+
+} // namespace MAYBE_UNINIT_NAMESPACE